@@ -0,0 +1,32 @@
+#ifndef HOST_FREERTOS_CONFIG_H
+#define HOST_FREERTOS_CONFIG_H
+
+// Configuração do FreeRTOS para a porta POSIX (intellitraffic_host): a mesma do
+// firmware, exceto o que depende do RP2040
+
+#include "../lib/FreeRTOSConfig.h"
+
+// Cada tarefa da porta POSIX é uma pthread; a pilha precisa de pelo menos PTHREAD_STACK_MIN
+#undef configMINIMAL_STACK_SIZE
+#define configMINIMAL_STACK_SIZE                ( configSTACK_DEPTH_TYPE ) 8192
+
+// A porta POSIX não consegue parar o seu tick; o ciclo de sono é estimado
+// pelo intellitraffic_sim
+#undef configUSE_TICKLESS_IDLE
+#define configUSE_TICKLESS_IDLE                 0
+#undef portSUPPRESS_TICKS_AND_SLEEP
+
+// Na porta POSIX cada tarefa roda na pilha da sua pthread, com folga de
+// sobra; a conferência de estouro é só do firmware
+#undef configCHECK_FOR_STACK_OVERFLOW
+#define configCHECK_FOR_STACK_OVERFLOW          0
+
+// A porta POSIX não é SMP
+#undef configNUM_CORES
+#define configNUM_CORES                         1
+#undef configUSE_CORE_AFFINITY
+
+#undef configSUPPORT_PICO_SYNC_INTEROP
+#undef configSUPPORT_PICO_TIME_INTEROP
+
+#endif // HOST_FREERTOS_CONFIG_H
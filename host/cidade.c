@@ -0,0 +1,358 @@
+#include "semaforo.h"
+#include "trafego.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <time.h>
+#include <pthread.h>
+
+// Simulação de uma malha de cruzamentos em tempo virtual, em várias threads.
+// Cada cruzamento é um Semaforo de lib/semaforo.c com duas aproximações: a via
+// (leste, atendida no verde) e a transversal (sul, atendida no vermelho). O
+// tempo avança em épocas: dentro de uma época cada cruzamento roda sozinho,
+// por eventos, e os carros que ele libera só chegam ao vizinho na época
+// seguinte (o tempo de percurso é uma época). Assim as threads não se
+// sincronizam dentro da época e o resultado não depende de quantas são.
+//
+//   intellitraffic_cidade [-x largura] [-y altura] [-d horas] [-e epoca_ms]
+//                         [-q carros/min] [-P plano] [-j threads] [-E]
+//
+// Os carros entram pelas bordas oeste e norte; uma linha e uma coluna em cada
+// quatro são corredores com o triplo da demanda. -E repete a simulação com 1,
+// 2, 4... até -j threads e mostra a aceleração.
+//
+// Os cruzamentos são divididos em blocos; cada thread começa com uma faixa
+// contígua deles e, quando acaba a sua, rouba blocos do início da faixa das
+// outras (os corredores deixam umas faixas mais caras que as outras).
+
+#define BLOCO 32
+#define LINHA_CACHE 64
+#define FATOR_CORREDOR 3
+#define NUNCA UINT32_MAX
+
+typedef struct {
+    uint32_t fila;
+    bool verde;
+    uint32_t proxima_saida;
+    uint32_t proxima_chegada;   // só nas bordas; NUNCA no interior
+    double taxa;                // carros por ms vindos de fora
+} Aproximacao;
+
+typedef struct {
+    Semaforo s;
+    uint32_t prazo;
+    uint32_t agora;
+    uint32_t contabilizado;     // até onde a integral das filas foi somada
+    Aproximacao vias[HAL_ADC_CANAIS];
+    uint32_t enviados[2][HAL_ADC_CANAIS];   // [época par/ímpar][direção] para o vizinho
+    uint64_t semente;           // por cruzamento: não depende da ordem de execução
+    uint64_t entraram;          // chegadas de fora da malha
+    uint64_t atendidos, saidos;
+    uint64_t fila_ms;           // soma das filas no tempo, carro x ms
+} Cruzamento;
+
+// Faixa de blocos de uma thread: a dona tira do fim, quem rouba tira do início.
+// Cada uma ocupa sua própria linha de cache, para que a trava de uma thread
+// não invalide a da vizinha a cada bloco.
+typedef struct {
+    pthread_mutex_t trava;
+    uint inicio, fim;
+    uint64_t roubados;
+} __attribute__((aligned(LINHA_CACHE))) Faixa;
+
+typedef struct {
+    uint largura, altura, n;
+    Cruzamento *cruzamentos;
+    uint32_t epoca_ms;
+    uint32_t inicio_epoca, fim;
+    uint paridade;
+    bool terminou;
+    uint threads;
+    Faixa *faixas;
+    pthread_barrier_t barreira;
+} Cidade;
+
+typedef struct {
+    Cidade *cidade;
+    uint indice;
+} Trabalhador;
+
+static uint32_t menor(uint32_t a, uint32_t b) {
+    return a < b ? a : b;
+}
+
+// Saídas injetadas: as luzes abrem e fecham as aproximações e os sensores
+// leem as filas, como os potenciômetros do plano atuado
+
+static void luz_cidade(void *ctx, uint id, Luz luz, bool acesa) {
+    Cruzamento *k = &((Cidade *)ctx)->cruzamentos[id];
+    Aproximacao *a;
+    if (luz == LUZ_VERDE)
+        a = &k->vias[SENSOR_VIA];
+    else if (luz == LUZ_VERMELHA)
+        a = &k->vias[SENSOR_TRANSVERSAL];
+    else
+        return;
+    if (acesa && !a->verde)
+        a->proxima_saida = k->agora + PERDA_PARTIDA;
+    a->verde = acesa;
+}
+
+static void buzzer_cidade(void *ctx, uint id, uint freq) {
+    (void)ctx, (void)id, (void)freq;
+}
+
+static uint16_t sensor_cidade(void *ctx, uint id, uint canal) {
+    return sensor_fila(((Cidade *)ctx)->cruzamentos[id].vias[canal].fila);
+}
+
+static void chegar(Aproximacao *a, uint32_t carros, uint32_t agora) {
+    a->fila += carros;
+    // Quem chega com o verde aberto e a fila parada sai na hora
+    if (a->verde && a->proxima_saida < agora)
+        a->proxima_saida = agora;
+}
+
+static void contabilizar(Cruzamento *k, uint32_t agora) {
+    k->fila_ms += (uint64_t)(k->vias[SENSOR_VIA].fila + k->vias[SENSOR_TRANSVERSAL].fila) * (agora - k->contabilizado);
+    k->contabilizado = agora;
+}
+
+// Via segue para leste, transversal para sul; na borda o carro sai da malha
+static void liberar(Cidade *c, uint id, uint direcao) {
+    Cruzamento *k = &c->cruzamentos[id];
+    uint x = id % c->largura, y = id / c->largura;
+    bool borda = direcao == SENSOR_VIA ? x + 1 == c->largura : y + 1 == c->altura;
+    k->atendidos++;
+    if (borda)
+        k->saidos++;
+    else
+        k->enviados[c->paridade][direcao]++;
+}
+
+static void avancar_cruzamento(Cidade *c, uint id) {
+    Cruzamento *k = &c->cruzamentos[id];
+    uint32_t inicio = c->inicio_epoca, fim = menor(c->inicio_epoca + c->epoca_ms, c->fim);
+    uint x = id % c->largura, y = id / c->largura;
+    uint anterior = c->paridade ^ 1;
+
+    // Carros liberados pelos vizinhos na época anterior
+    contabilizar(k, inicio);
+    if (x > 0)
+        chegar(&k->vias[SENSOR_VIA], c->cruzamentos[id - 1].enviados[anterior][SENSOR_VIA], inicio);
+    if (y > 0)
+        chegar(&k->vias[SENSOR_TRANSVERSAL], c->cruzamentos[id - c->largura].enviados[anterior][SENSOR_TRANSVERSAL],
+               inicio);
+    memset(k->enviados[c->paridade], 0, sizeof(k->enviados[0]));
+
+    while (1) {
+        uint32_t t = k->prazo;
+        for (int i = 0; i < HAL_ADC_CANAIS; ++i) {
+            const Aproximacao *a = &k->vias[i];
+            t = menor(t, a->proxima_chegada);
+            if (a->verde && a->fila)
+                t = menor(t, a->proxima_saida);
+        }
+        if (t >= fim)
+            break;
+
+        contabilizar(k, t);
+        k->agora = t;
+        for (int i = 0; i < HAL_ADC_CANAIS; ++i) {
+            Aproximacao *a = &k->vias[i];
+            if (a->proxima_chegada == t) {
+                chegar(a, 1, t);
+                k->entraram++;
+                a->proxima_chegada = t + intervalo_chegada(&k->semente, a->taxa);
+            }
+            if (a->verde && a->fila && a->proxima_saida <= t) {
+                a->fila--;
+                liberar(c, id, i);
+                a->proxima_saida = t + INTERVALO_SAIDA;
+            }
+        }
+        if (k->prazo <= t) {
+            uint32_t espera = semaforo_passo(&k->s, t);
+            k->prazo = t + (espera ? espera : 1);
+        }
+    }
+    contabilizar(k, fim);
+}
+
+static bool pegar_bloco(Faixa *f, bool roubo, uint *bloco) {
+    pthread_mutex_lock(&f->trava);
+    bool achou = f->inicio < f->fim;
+    if (achou) {
+        *bloco = roubo ? f->inicio++ : --f->fim;
+        f->roubados += roubo;
+    }
+    pthread_mutex_unlock(&f->trava);
+    return achou;
+}
+
+static void distribuir_blocos(Cidade *c) {
+    uint blocos = (c->n + BLOCO - 1) / BLOCO;
+    for (uint t = 0; t < c->threads; ++t) {
+        c->faixas[t].inicio = blocos * t / c->threads;
+        c->faixas[t].fim = blocos * (t + 1) / c->threads;
+    }
+}
+
+static void *trabalhar(void *arg) {
+    Trabalhador *w = arg;
+    Cidade *c = w->cidade;
+    while (!c->terminou) {
+        uint bloco;
+        for (uint v = 0; v < c->threads; ++v) {
+            // Primeiro a própria faixa, depois as das outras em sequência
+            Faixa *f = &c->faixas[(w->indice + v) % c->threads];
+            while (pegar_bloco(f, v != 0, &bloco)) {
+                uint fim = menor((bloco + 1) * BLOCO, c->n);
+                for (uint id = bloco * BLOCO; id < fim; ++id)
+                    avancar_cruzamento(c, id);
+            }
+        }
+
+        // Uma thread prepara a próxima época enquanto as outras esperam
+        if (pthread_barrier_wait(&c->barreira) == PTHREAD_BARRIER_SERIAL_THREAD) {
+            c->inicio_epoca += c->epoca_ms;
+            c->paridade ^= 1;
+            c->terminou = c->inicio_epoca >= c->fim;
+            distribuir_blocos(c);
+        }
+        pthread_barrier_wait(&c->barreira);
+    }
+    return NULL;
+}
+
+typedef struct {
+    double segundos;
+    uint64_t entraram, atendidos, saidos, fila_ms, roubados;
+} Resultado;
+
+static Resultado simular(Cidade *c, uint threads, double taxa, int plano) {
+    Resultado r = {0};
+    c->cruzamentos = calloc(c->n, sizeof(Cruzamento));
+    c->threads = threads;
+    c->faixas = aligned_alloc(LINHA_CACHE, threads * sizeof(Faixa));
+    memset(c->faixas, 0, threads * sizeof(Faixa));
+    c->inicio_epoca = 0;
+    c->paridade = 0;
+    c->terminou = false;
+
+    SaidasSemaforo saidas = {luz_cidade, buzzer_cidade, sensor_cidade, c};
+    for (uint id = 0; id < c->n; ++id) {
+        Cruzamento *k = &c->cruzamentos[id];
+        uint x = id % c->largura, y = id / c->largura;
+        semaforo_init(&k->s, &saidas, id);
+        if (plano >= 0)
+            semaforo_selecionar_plano(&k->s, plano);
+        k->semente = 0x9e3779b97f4a7c15ull * (id + 1);
+        // Cada controlador liga num instante diferente, como hoje sem coordenação
+        k->prazo = intervalo_chegada(&k->semente, 1.0 / 5000);
+        for (int i = 0; i < HAL_ADC_CANAIS; ++i) {
+            Aproximacao *a = &k->vias[i];
+            bool entrada = i == SENSOR_VIA ? x == 0 : y == 0;
+            bool corredor = (i == SENSOR_VIA ? y : x) % 4 == 0;
+            a->taxa = entrada ? taxa * (corredor ? FATOR_CORREDOR : 1) : 0;
+            a->proxima_chegada = entrada && a->taxa > 0 ? intervalo_chegada(&k->semente, a->taxa) : NUNCA;
+        }
+    }
+    for (uint t = 0; t < threads; ++t)
+        pthread_mutex_init(&c->faixas[t].trava, NULL);
+    pthread_barrier_init(&c->barreira, NULL, threads);
+    distribuir_blocos(c);
+
+    struct timespec t0, t1;
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    pthread_t ids[threads];
+    Trabalhador trabalhadores[threads];
+    for (uint t = 0; t < threads; ++t) {
+        trabalhadores[t] = (Trabalhador){c, t};
+        if (t > 0)
+            pthread_create(&ids[t], NULL, trabalhar, &trabalhadores[t]);
+    }
+    trabalhar(&trabalhadores[0]);
+    for (uint t = 1; t < threads; ++t)
+        pthread_join(ids[t], NULL);
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+    r.segundos = (t1.tv_sec - t0.tv_sec) + (t1.tv_nsec - t0.tv_nsec) / 1e9;
+
+    for (uint id = 0; id < c->n; ++id) {
+        const Cruzamento *k = &c->cruzamentos[id];
+        r.entraram += k->entraram;
+        r.atendidos += k->atendidos;
+        r.saidos += k->saidos;
+        r.fila_ms += k->fila_ms;
+    }
+    for (uint t = 0; t < threads; ++t) {
+        r.roubados += c->faixas[t].roubados;
+        pthread_mutex_destroy(&c->faixas[t].trava);
+    }
+    pthread_barrier_destroy(&c->barreira);
+    free(c->faixas);
+    free(c->cruzamentos);
+    return r;
+}
+
+int main(int argc, char **argv) {
+    Cidade cidade = {.largura = 64, .altura = 64, .epoca_ms = 1000};
+    double horas = 1;
+    double taxa = 3;
+    int plano = PLANO_ATUADO;
+    long nucleos = sysconf(_SC_NPROCESSORS_ONLN);
+    uint threads = nucleos > 0 ? (uint)nucleos : 1;
+    bool escala = false;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "x:y:d:e:q:P:j:E")) != -1) {
+        switch (opt) {
+            case 'x': cidade.largura = strtoul(optarg, NULL, 10); break;
+            case 'y': cidade.altura = strtoul(optarg, NULL, 10); break;
+            case 'd': horas = atof(optarg); break;
+            case 'e': cidade.epoca_ms = strtoul(optarg, NULL, 10); break;
+            case 'q': taxa = atof(optarg); break;
+            case 'j': threads = strtoul(optarg, NULL, 10); break;
+            case 'E': escala = true; break;
+            case 'P':
+                plano = plano_por_nome(optarg);
+                if (plano < 0) {
+                    fprintf(stderr, "plano desconhecido: %s\n", optarg);
+                    return 1;
+                }
+                break;
+            default:
+                fprintf(stderr, "uso: %s [-x largura] [-y altura] [-d horas] [-e epoca_ms] [-q carros/min] "
+                                "[-P plano] [-j threads] [-E]\n", argv[0]);
+                return 1;
+        }
+    }
+    cidade.n = cidade.largura * cidade.altura;
+    if (!cidade.n || !cidade.epoca_ms || !threads || horas <= 0 || horas * 3600 * 1000 >= NUNCA) {
+        fprintf(stderr, "parâmetros inválidos\n");
+        return 1;
+    }
+    cidade.fim = (uint32_t)(horas * 3600 * 1000);
+
+    printf("%ux%u cruzamentos, plano %s, %.1f h em épocas de %u ms, %ld núcleos\n", cidade.largura, cidade.altura,
+           planos[plano].nome, horas, cidade.epoca_ms, nucleos);
+    Resultado base = {0};
+    for (uint t = escala ? 1 : threads; t <= threads; t = t * 2 > threads && t < threads ? threads : t * 2) {
+        Resultado r = simular(&cidade, t, taxa / 60000.0, plano);
+        if (!base.segundos)
+            base = r;
+        printf("%3u threads: %8.3f s, %10.0f s simulados/s de relógio (%7.0f cruzamento-s/s), %.2fx, %llu blocos roubados\n",
+               t, r.segundos, horas * 3600 / r.segundos, horas * 3600 * cidade.n / r.segundos,
+               base.segundos / r.segundos, (unsigned long long)r.roubados);
+        if (r.atendidos != base.atendidos || r.fila_ms != base.fila_ms) {
+            printf("FALHA: resultado diferente do de %u thread(s)\n", escala ? 1 : threads);
+            return 1;
+        }
+    }
+    printf("%llu carros entraram, %llu atravessaram a malha (%.0f/h), %llu passagens por cruzamento\n",
+           (unsigned long long)base.entraram, (unsigned long long)base.saidos,
+           base.saidos / horas, (unsigned long long)base.atendidos);
+    printf("espera média por cruzamento: %.1f s\n", base.atendidos ? base.fila_ms / 1000.0 / base.atendidos : 0);
+    return 0;
+}
@@ -0,0 +1,205 @@
+#define _GNU_SOURCE
+#include "host.h"
+#include "energia.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <pthread.h>
+#include <signal.h>
+#include <time.h>
+#include "FreeRTOS.h"
+#include "task.h"
+
+// Implementação da HAL no Linux. As saídas só ficam em memória; com a variável
+// de ambiente INTELLITRAFFIC_TRACE definida cada mudança é impressa. Linhas
+// digitadas no terminal com o número de um GPIO simulam um toque no botão;
+// "a0 3000" põe o potenciômetro do canal 0 do ADC em 3000.
+
+#define NUM_GPIOS 30
+#define DURACAO_TOQUE_MS 100
+
+static volatile bool gpio_nivel[NUM_GPIOS];
+static uint buzzer_freq[NUM_GPIOS];
+static struct timespec inicio;
+static bool trace;
+static uint32_t led_strip_quadros;
+static hal_gpio_irq_t gpio_irq[NUM_GPIOS];
+static uint32_t gpio_irq_pendente;
+static volatile uint16_t adc_valor[HAL_ADC_CANAIS];
+
+static void host_log(const char *fmt, unsigned a, unsigned b) {
+    if (!trace)
+        return;
+    printf("[%8u ms] ", hal_millis());
+    printf(fmt, a, b);
+    printf("\n");
+    fflush(stdout);
+}
+
+static void sleep_real_ms(uint32_t ms) {
+    struct timespec ts = {ms / 1000, (long)(ms % 1000) * 1000000L};
+    while (nanosleep(&ts, &ts) != 0)
+        ;
+}
+
+// Thread fora do FreeRTOS: não chama a API do kernel e bloqueia todos os sinais
+// para não receber o SIGALRM do tick da porta POSIX
+static void *leitor_botoes(void *arg) {
+    (void)arg;
+    sigset_t todos;
+    sigfillset(&todos);
+    pthread_sigmask(SIG_BLOCK, &todos, NULL);
+
+    char linha[32];
+    while (fgets(linha, sizeof(linha), stdin)) {
+        // "a<canal> <valor>" gira o potenciômetro do canal
+        uint canal, valor;
+        if (sscanf(linha, "a%u %u", &canal, &valor) == 2) {
+            hal_host_set_adc(canal, valor);
+            continue;
+        }
+        uint pin = strtoul(linha, NULL, 10);
+        if (pin >= NUM_GPIOS)
+            continue;
+        hal_host_set_input(pin, false);
+        sleep_real_ms(DURACAO_TOQUE_MS);
+        hal_host_set_input(pin, true);
+    }
+    return NULL;
+}
+
+void hal_init(void) {
+    clock_gettime(CLOCK_MONOTONIC, &inicio);
+    trace = getenv("INTELLITRAFFIC_TRACE") != NULL;
+
+    pthread_t thread;
+    if (pthread_create(&thread, NULL, leitor_botoes, NULL) == 0)
+        pthread_detach(thread);
+}
+
+void hal_host_set_input(uint pin, bool value) {
+    if (pin >= NUM_GPIOS)
+        return;
+    bool anterior = __atomic_exchange_n(&gpio_nivel[pin], value, __ATOMIC_RELAXED);
+    if (anterior && !value && gpio_irq[pin])
+        __atomic_fetch_or(&gpio_irq_pendente, 1u << pin, __ATOMIC_RELEASE);
+}
+
+void hal_host_set_adc(uint canal, uint16_t valor) {
+    if (canal < HAL_ADC_CANAIS)
+        adc_valor[canal] = valor > 4095 ? 4095 : valor;
+}
+
+// Faz o papel do controlador de interrupções: a thread do terminal não pode
+// chamar a API do FreeRTOS, então marca a borda e esta tarefa, na maior
+// prioridade, chama os callbacks
+static void tarefa_irq(void *arg) {
+    (void)arg;
+    while (1) {
+        uint32_t pendente = __atomic_exchange_n(&gpio_irq_pendente, 0, __ATOMIC_ACQUIRE);
+        for (uint pin = 0; pin < NUM_GPIOS; ++pin)
+            if (pendente & (1u << pin))
+                gpio_irq[pin](pin);
+        vTaskDelay(pdMS_TO_TICKS(10));
+    }
+}
+
+void hal_gpio_irq_falling(uint pin, hal_gpio_irq_t callback) {
+    static bool tarefa_criada;
+    if (pin >= NUM_GPIOS)
+        return;
+    gpio_irq[pin] = callback;
+    if (!tarefa_criada) {
+        xTaskCreate(tarefa_irq, "IRQ", configMINIMAL_STACK_SIZE, NULL, configMAX_PRIORITIES - 1, NULL);
+        tarefa_criada = true;
+    }
+}
+
+// Uma placa só no host: não há escravas para receber o pulso
+void hal_gpio_pulso_periodico(uint pin, uint32_t periodo_ms, uint32_t largura_us) {
+    host_log("gpio %u: pulso de sincronia a cada %u ms", pin, periodo_ms);
+}
+
+void hal_gpio_init_output(uint pin) {
+    hal_host_set_input(pin, false);
+}
+
+void hal_gpio_init_input_pullup(uint pin) {
+    hal_host_set_input(pin, true);
+}
+
+void hal_gpio_put(uint pin, bool value) {
+    if (pin >= NUM_GPIOS || gpio_nivel[pin] == value)
+        return;
+    gpio_nivel[pin] = value;
+    host_log("gpio %u = %u", pin, value);
+}
+
+bool hal_gpio_get(uint pin) {
+    return pin < NUM_GPIOS && __atomic_load_n(&gpio_nivel[pin], __ATOMIC_RELAXED);
+}
+
+void hal_pwm_tone_start(uint pin, uint freq) {
+    if (pin >= NUM_GPIOS)
+        return;
+    buzzer_freq[pin] = freq;
+    host_log("pwm %u = %u Hz", pin, freq);
+}
+
+void hal_pwm_tone_stop(uint pin) {
+    if (pin >= NUM_GPIOS || buzzer_freq[pin] == 0)
+        return;
+    buzzer_freq[pin] = 0;
+    host_log("pwm %u = %u Hz", pin, 0);
+}
+
+void hal_led_strip_init(uint strip, uint pin, float freq, bool rgbw) {
+    (void)freq;
+    (void)rgbw;
+    host_log("led strip %u no pino %u", strip, pin);
+}
+
+void hal_led_strip_write(uint strip, const uint32_t *pixels, size_t count) {
+    (void)pixels;
+    ++led_strip_quadros;
+    host_log("led strip %u: quadro com %u pixels", strip, (unsigned)count);
+}
+
+bool hal_led_strip_pronta(uint strip) {
+    (void)strip;
+    return true;
+}
+
+void hal_adc_init(uint amostras_por_segundo) {
+    host_log("adc: %u canais, %u amostras/s", HAL_ADC_CANAIS, amostras_por_segundo);
+}
+
+uint16_t hal_adc_media(uint canal) {
+    return canal < HAL_ADC_CANAIS ? adc_valor[canal] : 0;
+}
+
+i2c_inst_t *hal_i2c_init(uint index, uint baudrate, uint sda, uint scl) {
+    (void)baudrate;
+    (void)sda;
+    (void)scl;
+    host_log("i2c%u (%u)", index, 0);
+    return NULL;
+}
+
+uint32_t hal_millis(void) {
+    return (uint32_t)(hal_micros() / 1000);
+}
+
+uint64_t hal_micros(void) {
+    struct timespec agora;
+    clock_gettime(CLOCK_MONOTONIC, &agora);
+    return (uint64_t)((agora.tv_sec - inicio.tv_sec) * 1000000 + (agora.tv_nsec - inicio.tv_nsec) / 1000);
+}
+
+void hal_sleep_ms(uint32_t ms) {
+    sleep_real_ms(ms);
+}
+
+// O port POSIX não tem tickless idle: nada a contar
+EnergiaContagem energia_contagem(void) {
+    return (EnergiaContagem){0};
+}
@@ -0,0 +1,19 @@
+#ifndef HOST_H
+#define HOST_H
+
+// Funções disponíveis apenas no executável intellitraffic_host
+
+#include "hal.h"
+
+// Força o nível de uma entrada (simula o botão: false = pressionado)
+void hal_host_set_input(uint pin, bool value);
+
+// Posição do potenciômetro de um canal do ADC (0..4095)
+void hal_host_set_adc(uint canal, uint16_t valor);
+
+// Conteúdo da GDDRAM do display simulado (colunas x páginas, como o ram_buffer)
+const uint8_t *ssd1306_host_gddram(void);
+// Bytes transmitidos ao display simulado desde o início
+size_t ssd1306_host_bus_bytes(void);
+
+#endif // HOST_H
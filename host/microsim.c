@@ -0,0 +1,330 @@
+#include "semaforo.h"
+#include "trafego.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <time.h>
+
+// Microssimulação de tráfego (autômato celular de Nagel–Schreckenberg) nas
+// duas aproximações de um cruzamento, controlado por lib/semaforo.c. Cada
+// faixa é um vetor de bytes, um por célula de 7,5 m: a velocidade do carro
+// (0..VMAX células/s) ou VAZIO. A cada segundo todos os carros:
+//
+//   1. aceleram: v = min(v + 1, VMAX)
+//   2. freiam pela distância livre à frente: v = min(v, lacuna)
+//   3. com probabilidade p, perdem uma unidade: v = max(v - 1, 0)
+//   4. andam v células
+//
+// Na linha de parada, enquanto a faixa não está com verde, a célula seguinte
+// recebe uma PAREDE, que conta como ocupada na lacuna e não anda. As faixas
+// têm PARADA_FIM células depois da linha; quem passa do fim sai da simulação.
+//
+// As duas fases são escritas por célula, sem laço por carro, e rodam 16
+// células por vez com os vetores do GCC (SSE2 no x86, NEON no ARM):
+// - lacuna: para k = VMAX..1, lacuna = ocupada[i + k] ? k - 1 : lacuna
+// - movimento: a célula j recebe o carro de j - k cuja velocidade é k; sem
+//   ultrapassagem, no máximo um k bate.
+// Com -k escalar roda a versão clássica, carro a carro; -V confere que as duas
+// dão o mesmo resultado com os mesmos sorteios.
+//
+//   intellitraffic_microsim [-d horas] [-q via,transversal] [-P plano]
+//                           [-p freio] [-L celulas] [-k escalar] [-V]
+//
+// -q dá a demanda em carros/min (padrão 10,10). O relatório traz a vazão na
+// linha de parada, o atraso médio (tempo na aproximação menos o de percorrê-la
+// livre), a fila média e a máxima e as atualizações de célula por segundo.
+
+#define VMAX 5
+#define VAZIO 0xFF
+#define PAREDE 0xFE
+#define VETOR 16
+#define MARGEM VETOR            // >= VMAX, para ler i + k e j - k sem testar
+#define PARADA_FIM 40           // células depois da linha de parada
+#define ALCANCE_SENSOR 40       // células antes da linha vistas pelo sensor
+#define PASSO_MS 1000
+
+typedef uint8_t v16 __attribute__((vector_size(VETOR)));
+
+typedef struct {
+    const char *nome;
+    uint8_t *vel, *novo;        // com MARGEM antes e depois
+    uint8_t *sorteios;
+    uint celulas;               // múltiplo de VETOR, com folga para quem sai
+    uint fim;                   // células usadas; de fim em diante é a saída
+    uint parada;                // primeira célula depois da linha de parada
+    bool verde;
+    double chance_chegada;      // por passo
+    uint32_t esperando;         // carros que ainda não couberam na faixa
+    uint32_t fila;              // parados antes da linha, para o sensor
+    uint64_t entraram, passaram, saidos;
+    uint64_t carros_passo;      // soma, passo a passo, dos carros antes da linha e esperando
+    uint64_t fila_soma;
+    uint32_t fila_max;
+} Faixa;
+
+static uint64_t semente = SEMENTE_TRAFEGO;
+
+static v16 carregar(const uint8_t *p) {
+    v16 v;
+    memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+static v16 repetir(uint8_t x) {
+    return (v16){0} + x;
+}
+
+static v16 escolher(v16 mascara, v16 sim, v16 nao) {
+    return (mascara & sim) | (~mascara & nao);
+}
+
+// Um byte aleatório por célula, 8 por sorteio
+static void sortear(uint8_t *sorteios, uint n) {
+    for (uint i = 0; i < n; i += 8) {
+        uint64_t r = xorshift64(&semente);
+        memcpy(sorteios + i, &r, 8);
+    }
+}
+
+static void velocidades_vetor(uint8_t *vel, const uint8_t *sorteios, uint n, uint8_t limiar) {
+    const v16 vazio = repetir(VAZIO), parede = repetir(PAREDE), vmax = repetir(VMAX);
+    const v16 zero = repetir(0), um = repetir(1);
+    for (uint i = 0; i < n; i += VETOR) {
+        v16 v = carregar(vel + i);
+        v16 carro = (v16)(v < parede);
+        v16 a = v + um;
+        a = escolher((v16)(a > vmax), vmax, a);
+        v16 lacuna = vmax;
+        for (int k = VMAX; k >= 1; --k) {
+            v16 ocupada = (v16)(carregar(vel + i + k) != vazio);
+            lacuna = escolher(ocupada, repetir(k - 1), lacuna);
+        }
+        a = escolher((v16)(a < lacuna), a, lacuna);
+        v16 freia = (v16)(carregar(sorteios + i) < repetir(limiar)) & (v16)(a > zero);
+        a -= freia & um;
+        v = escolher(carro, a, v);
+        memcpy(vel + i, &v, sizeof(v));
+    }
+}
+
+static void mover_vetor(const uint8_t *vel, uint8_t *novo, uint n) {
+    const v16 vazio = repetir(VAZIO);
+    for (uint j = 0; j < n; j += VETOR) {
+        v16 destino = vazio;
+        for (int k = 0; k <= VMAX; ++k) {
+            v16 veio = (v16)(carregar(vel + j - k) == repetir(k));
+            destino = escolher(veio, repetir(k), destino);
+        }
+        memcpy(novo + j, &destino, sizeof(destino));
+    }
+}
+
+// Versão clássica, carro a carro, para comparação
+static void velocidades_escalar(uint8_t *vel, const uint8_t *sorteios, uint n, uint8_t limiar) {
+    for (uint i = 0; i < n; ++i) {
+        if (vel[i] >= PAREDE)
+            continue;
+        uint a = vel[i] + 1 > VMAX ? VMAX : vel[i] + 1;
+        uint lacuna = 0;
+        while (lacuna < a && vel[i + lacuna + 1] == VAZIO)
+            lacuna++;
+        if (a > lacuna)
+            a = lacuna;
+        if (sorteios[i] < limiar && a > 0)
+            a--;
+        vel[i] = a;
+    }
+}
+
+static void mover_escalar(const uint8_t *vel, uint8_t *novo, uint n) {
+    memset(novo, VAZIO, n);
+    for (uint i = 0; i < n; ++i) {
+        if (vel[i] < PAREDE)
+            novo[i + vel[i]] = vel[i];
+    }
+}
+
+static bool usar_escalar;
+
+static void faixa_init(Faixa *f, const char *nome, uint celulas, double carros_min) {
+    f->nome = nome;
+    f->fim = celulas;
+    f->parada = celulas - PARADA_FIM;
+    f->celulas = (celulas + VMAX + VETOR - 1) / VETOR * VETOR;
+    uint total = f->celulas + 2 * MARGEM;
+    f->vel = malloc(total);
+    f->novo = malloc(total);
+    f->sorteios = malloc(f->celulas);
+    memset(f->vel, VAZIO, total);
+    memset(f->novo, VAZIO, total);
+    f->vel += MARGEM;
+    f->novo += MARGEM;
+    f->chance_chegada = carros_min / 60.0 * PASSO_MS / 1000.0;
+}
+
+static void faixa_passo(Faixa *f, uint8_t limiar) {
+    uint8_t *vel = f->vel;
+
+    // Chegadas: entram na primeira célula quando ela está livre
+    if (aleatorio(&semente) < f->chance_chegada)
+        f->esperando++;
+    if (f->esperando && vel[0] == VAZIO) {
+        vel[0] = 0;
+        f->esperando--;
+        f->entraram++;
+    }
+    if (!f->verde && vel[f->parada] == VAZIO)
+        vel[f->parada] = PAREDE;
+
+    sortear(f->sorteios, f->celulas);
+    if (usar_escalar)
+        velocidades_escalar(vel, f->sorteios, f->celulas, limiar);
+    else
+        velocidades_vetor(vel, f->sorteios, f->celulas, limiar);
+
+    // Só as poucas células em volta da linha e do fim são vistas uma a uma
+    for (uint i = f->parada - VMAX; i < f->parada; ++i)
+        f->passaram += vel[i] < PAREDE && i + vel[i] >= f->parada;
+    if (usar_escalar)
+        mover_escalar(vel, f->novo, f->celulas);
+    else
+        mover_vetor(vel, f->novo, f->celulas);
+    f->vel = f->novo;
+    f->novo = vel;
+    vel = f->vel;
+    for (uint i = f->fim; i < f->celulas; ++i) {
+        f->saidos += vel[i] != VAZIO;
+        vel[i] = VAZIO;
+    }
+
+    f->fila = 0;
+    for (uint i = f->parada - ALCANCE_SENSOR; i < f->parada; ++i)
+        f->fila += vel[i] == 0;
+    f->fila_soma += f->fila;
+    if (f->fila > f->fila_max)
+        f->fila_max = f->fila;
+    f->carros_passo += f->entraram - f->passaram + f->esperando;
+}
+
+static Faixa faixas[HAL_ADC_CANAIS];
+
+// Saídas injetadas no semáforo: o verde abre a via, o vermelho a transversal
+
+static void luz_micro(void *ctx, uint id, Luz luz, bool acesa) {
+    (void)ctx, (void)id;
+    if (luz == LUZ_VERDE)
+        faixas[SENSOR_VIA].verde = acesa;
+    else if (luz == LUZ_VERMELHA)
+        faixas[SENSOR_TRANSVERSAL].verde = acesa;
+}
+
+static void buzzer_micro(void *ctx, uint id, uint freq) {
+    (void)ctx, (void)id, (void)freq;
+}
+
+static uint16_t sensor_micro(void *ctx, uint id, uint canal) {
+    (void)ctx, (void)id;
+    return sensor_fila(faixas[canal].fila);
+}
+
+static const SaidasSemaforo saidas_micro = {luz_micro, buzzer_micro, sensor_micro, NULL};
+
+// Roda as duas versões lado a lado com os mesmos sorteios
+static int conferir(uint celulas, uint8_t limiar) {
+    Faixa a, b;
+    faixa_init(&a, "vetor", celulas, 30);
+    faixa_init(&b, "escalar", celulas, 30);
+    for (uint passo = 0; passo < 100000; ++passo) {
+        // Sinal alternando a cada 30 s, para ter filas e partidas
+        a.verde = b.verde = passo / 30 % 2;
+        uint64_t s = semente;
+        usar_escalar = false;
+        faixa_passo(&a, limiar);
+        semente = s;
+        usar_escalar = true;
+        faixa_passo(&b, limiar);
+        if (memcmp(a.vel - MARGEM, b.vel - MARGEM, a.celulas + 2 * MARGEM) != 0) {
+            printf("FALHA: as versões divergem no passo %u\n", passo);
+            return 1;
+        }
+    }
+    printf("vetor e escalar iguais em 100000 passos (%llu carros passaram)\n", (unsigned long long)a.passaram);
+    return 0;
+}
+
+int main(int argc, char **argv) {
+    double horas = 100;
+    double demanda[HAL_ADC_CANAIS] = {10, 10};
+    int plano = PLANO_FORA_PICO;
+    double freio = 0.2;
+    uint celulas = 400;
+    bool verificar = false;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "d:q:P:p:L:kV")) != -1) {
+        switch (opt) {
+            case 'd': horas = atof(optarg); break;
+            case 'p': freio = atof(optarg); break;
+            case 'L': celulas = strtoul(optarg, NULL, 10); break;
+            case 'k': usar_escalar = true; break;
+            case 'V': verificar = true; break;
+            case 'q':
+                demanda[SENSOR_VIA] = atof(optarg);
+                demanda[SENSOR_TRANSVERSAL] = strchr(optarg, ',') ? atof(strchr(optarg, ',') + 1) : demanda[SENSOR_VIA];
+                break;
+            case 'P':
+                plano = plano_por_nome(optarg);
+                if (plano < 0) {
+                    fprintf(stderr, "plano desconhecido: %s\n", optarg);
+                    return 1;
+                }
+                break;
+            default:
+                fprintf(stderr, "uso: %s [-d horas] [-q via,transversal] [-P plano] [-p freio] [-L celulas] [-k] [-V]\n",
+                        argv[0]);
+                return 1;
+        }
+    }
+    if (celulas < PARADA_FIM + ALCANCE_SENSOR + VMAX || freio < 0 || freio > 1) {
+        fprintf(stderr, "parâmetros inválidos\n");
+        return 1;
+    }
+    uint8_t limiar = (uint8_t)(freio * 255 + 0.5);
+    if (verificar)
+        return conferir(celulas, limiar);
+
+    faixa_init(&faixas[SENSOR_VIA], "via", celulas, demanda[SENSOR_VIA]);
+    faixa_init(&faixas[SENSOR_TRANSVERSAL], "transversal", celulas, demanda[SENSOR_TRANSVERSAL]);
+    Semaforo semaforo;
+    semaforo_init(&semaforo, &saidas_micro, 0);
+    semaforo_selecionar_plano(&semaforo, plano);
+
+    uint64_t passos = (uint64_t)(horas * 3600 * 1000 / PASSO_MS);
+    uint32_t prazo = 0;
+    struct timespec t0, t1;
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    for (uint64_t passo = 0; passo < passos; ++passo) {
+        uint32_t agora = (uint32_t)(passo * PASSO_MS);
+        while ((int32_t)(agora - prazo) >= 0) {
+            uint32_t espera = semaforo_passo(&semaforo, prazo);
+            prazo += espera ? espera : 1;
+        }
+        for (int i = 0; i < HAL_ADC_CANAIS; ++i)
+            faixa_passo(&faixas[i], limiar);
+    }
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+    double segundos = (t1.tv_sec - t0.tv_sec) + (t1.tv_nsec - t0.tv_nsec) / 1e9;
+
+    printf("plano %s, %.1f h simuladas em %.3f s (%s)\n", planos[plano].nome, horas, segundos,
+           usar_escalar ? "escalar" : "vetor");
+    printf("%.1f M atualizações de célula/s\n", passos * HAL_ADC_CANAIS * (double)faixas[0].celulas / segundos / 1e6);
+    double livre = (faixas[0].parada - 1) / (VMAX - freio);
+    for (int i = 0; i < HAL_ADC_CANAIS; ++i) {
+        const Faixa *f = &faixas[i];
+        double atraso = f->passaram ? (double)f->carros_passo / f->passaram - livre : 0;
+        printf("%-12s %6.1f carros/min, vazão %6.0f carros/h, atraso médio %6.1f s, fila média %5.1f, máxima %u\n",
+               f->nome, demanda[i], f->passaram / horas, atraso, (double)f->fila_soma / passos, f->fila_max);
+    }
+    return 0;
+}
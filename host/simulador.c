@@ -0,0 +1,410 @@
+#include "semaforo.h"
+#include "cena.h"
+#include "energia.h"
+#include "trafego.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <time.h>
+
+// Simulador do semáforo em tempo virtual. Executa lib/semaforo.c sem FreeRTOS:
+// o relógio só avança de prazo em prazo, como a tarefa do semáforo, então horas
+// de operação passam em milissegundos. As saídas injetadas no semáforo registram
+// cada mudança de LED e buzzer, o laço registra o sinal de pedestre no display
+// e, com -t, tudo vai para um trace em CSV.
+// Também acompanha quando as tarefas do display e da matriz acordam, para
+// estimar quanto tempo o tickless idle deixa o RP2040 dormindo.
+//
+//   intellitraffic_sim [-d horas] [-b ms]... [-P plano[@ms]] [-q via,transversal]
+//                      [-p ms] [-c us] [-t trace.csv]
+//
+// -b aperta o botão A (alterna o modo noturno) no instante indicado.
+// -P pede o plano de tempo (fora, pico, atuado, coordenado ou noturno) no instante
+//    indicado (padrão 0); a troca vale no fim do ciclo em andamento.
+// -q liga o modelo de tráfego: chegadas aleatórias (carros/min) na via do
+//    semáforo, atendida no verde, e na transversal, atendida no vermelho. As
+//    filas alimentam os sensores do ADC do plano atuado e o simulador informa
+//    o atraso médio por carro.
+// -p reproduz o firmware antigo, em que as tarefas do semáforo e do botão
+//    acordavam a cada p ms (10) para conferir os tempos; sem tickless idle,
+//    ele nunca dormia.
+// -c tempo acordado por despertar de tarefa (padrão 200 µs).
+
+#define MAX_BOTOES 64
+#define NUNCA UINT64_MAX
+// configEXPECTED_IDLE_TIME_BEFORE_SLEEP: intervalos menores não viram sono
+#define ESPERA_MINIMA_SONO 2
+
+typedef enum {
+    SAIDA_VERMELHO,
+    SAIDA_AMARELO,
+    SAIDA_VERDE,
+    SAIDA_BUZZER,
+    SAIDA_SINAL,
+    SAIDA_DISPLAY,
+    NUM_SAIDAS
+} Saida;
+
+typedef struct {
+    const char *nome;
+    uint valor;
+    uint64_t inicio;        // instante da última ativação
+    uint64_t ativacoes;
+    uint64_t ligado_min, ligado_max;
+    uint64_t periodo_min, periodo_max;
+} Registro;
+
+static Registro registros[NUM_SAIDAS] = {
+    [SAIDA_VERMELHO] = {.nome = "vermelho"},
+    [SAIDA_AMARELO] = {.nome = "amarelo"},
+    [SAIDA_VERDE] = {.nome = "verde"},
+    [SAIDA_BUZZER] = {.nome = "buzzer"},
+    [SAIDA_SINAL] = {.nome = "sinal"},
+    [SAIDA_DISPLAY] = {.nome = "display"},
+};
+
+static uint64_t relogio;
+static uint64_t num_eventos;
+static uint64_t despertares;
+// As mesmas contagens que energia_contagem dá no firmware
+static EnergiaContagem energia;
+static uint64_t quadros_display;
+static uint64_t quadros_matriz;
+static FILE *trace;
+
+static void min_max(uint64_t valor, uint64_t *min, uint64_t *max) {
+    if (*max == 0 || valor < *min)
+        *min = valor;
+    if (valor > *max)
+        *max = valor;
+}
+
+static void registrar(Saida saida, uint valor) {
+    Registro *r = &registros[saida];
+    if (valor == r->valor)
+        return;
+    if (valor && !r->valor) {
+        if (r->ativacoes)
+            min_max(relogio - r->inicio, &r->periodo_min, &r->periodo_max);
+        r->inicio = relogio;
+        r->ativacoes++;
+    } else if (!valor) {
+        min_max(relogio - r->inicio, &r->ligado_min, &r->ligado_max);
+    }
+    r->valor = valor;
+    num_eventos++;
+    if (trace)
+        fprintf(trace, "%llu,%s,%u\n", (unsigned long long)relogio, r->nome, valor);
+}
+
+// Modelo de tráfego: chegadas de Poisson em cada aproximação. No verde o
+// primeiro carro sai PERDA_PARTIDA ms depois da abertura e os seguintes a cada
+// INTERVALO_SAIDA ms; quem chega com a fila vazia e o verde aberto não para.
+#define MAX_FILA 4096
+
+typedef struct {
+    const char *nome;
+    double taxa;                  // carros por ms
+    bool verde;
+    uint64_t proxima_chegada;
+    uint64_t proxima_saida;
+    uint64_t fila[MAX_FILA];      // instantes de chegada, circular
+    uint32_t inicio, tamanho;
+    uint64_t chegadas, atendidos, atraso_total, fila_max;
+} Aproximacao;
+
+static Aproximacao vias[HAL_ADC_CANAIS] = {
+    [SENSOR_VIA] = {.nome = "via"},
+    [SENSOR_TRANSVERSAL] = {.nome = "transversal"},
+};
+static bool trafego;
+static uint64_t semente = SEMENTE_TRAFEGO;
+static uint64_t ciclos;
+
+// Processa chegadas e saídas anteriores a ate, com o sinal atual
+static void avancar_fila(Aproximacao *a, uint64_t ate) {
+    if (a->taxa <= 0)
+        return;
+    while (1) {
+        uint64_t saida = UINT64_MAX;
+        if (a->verde && a->tamanho) {
+            uint64_t chegada = a->fila[a->inicio];
+            saida = a->proxima_saida > chegada ? a->proxima_saida : chegada;
+        }
+        if (a->proxima_chegada < ate && a->proxima_chegada <= saida) {
+            if (a->tamanho < MAX_FILA) {
+                a->fila[(a->inicio + a->tamanho++) % MAX_FILA] = a->proxima_chegada;
+                if (a->tamanho > a->fila_max)
+                    a->fila_max = a->tamanho;
+            }
+            a->chegadas++;
+            a->proxima_chegada += intervalo_chegada(&semente, a->taxa);
+        } else if (saida < ate) {
+            a->atraso_total += saida - a->fila[a->inicio];
+            a->inicio = (a->inicio + 1) % MAX_FILA;
+            a->tamanho--;
+            a->atendidos++;
+            a->proxima_saida = saida + INTERVALO_SAIDA;
+        } else {
+            break;
+        }
+    }
+}
+
+static void sinal_aproximacao(Aproximacao *a, bool verde) {
+    if (verde && !a->verde)
+        a->proxima_saida = relogio + PERDA_PARTIDA;
+    a->verde = verde;
+}
+
+// Saídas e sensores injetados no semáforo simulado
+
+static void luz_simulada(void *ctx, uint id, Luz luz, bool acesa) {
+    (void)ctx, (void)id;
+    if (trafego && luz == LUZ_VERDE) {
+        sinal_aproximacao(&vias[SENSOR_VIA], acesa);
+        ciclos += acesa;
+    }
+    if (trafego && luz == LUZ_VERMELHA)
+        sinal_aproximacao(&vias[SENSOR_TRANSVERSAL], acesa);
+    static const Saida saidas[NUM_LUZES] = {SAIDA_VERMELHO, SAIDA_AMARELO, SAIDA_VERDE};
+    registrar(saidas[luz], acesa);
+}
+
+static void buzzer_simulado(void *ctx, uint id, uint freq) {
+    (void)ctx, (void)id;
+    registrar(SAIDA_BUZZER, freq);
+}
+
+// Potenciômetro proporcional à fila, saturando em FILA_SENSOR_CHEIO carros
+static uint16_t sensor_simulado(void *ctx, uint id, uint canal) {
+    (void)ctx, (void)id;
+    if (!trafego || canal >= HAL_ADC_CANAIS)
+        return 0;
+    return sensor_fila(vias[canal].tamanho);
+}
+
+static const SaidasSemaforo saidas_simuladas = {luz_simulada, buzzer_simulado, sensor_simulado, NULL};
+
+static bool mudanca_visivel(const SemaforoEstado *a, const SemaforoEstado *b) {
+    return a->modo_noturno != b->modo_noturno || a->estado != b->estado || a->exibindo_sinal != b->exibindo_sinal ||
+           a->contagem != b->contagem;
+}
+
+static uint64_t arredondar(uint64_t t, uint64_t periodo) {
+    return (t + periodo - 1) / periodo * periodo;
+}
+
+static uint64_t menor(uint64_t a, uint64_t b) {
+    return a < b ? a : b;
+}
+
+static int comparar(const void *a, const void *b) {
+    uint64_t x = *(const uint64_t *)a, y = *(const uint64_t *)b;
+    return x < y ? -1 : x > y;
+}
+
+int main(int argc, char **argv) {
+    double horas = 1000;
+    uint64_t botoes[MAX_BOTOES];
+    int num_botoes = 0;
+    uint64_t periodo = 0;
+    uint64_t custo_us = 200;
+    int plano = -1;
+    uint64_t tempo_plano = 0;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "d:b:P:q:p:c:t:")) != -1) {
+        switch (opt) {
+            case 'd':
+                horas = atof(optarg);
+                break;
+            case 'b':
+                if (num_botoes < MAX_BOTOES)
+                    botoes[num_botoes++] = strtoull(optarg, NULL, 10);
+                break;
+            case 'P':
+                plano = plano_por_nome(optarg);
+                if (plano < 0) {
+                    fprintf(stderr, "plano desconhecido: %s\n", optarg);
+                    return 1;
+                }
+                if (strchr(optarg, '@'))
+                    tempo_plano = strtoull(strchr(optarg, '@') + 1, NULL, 10);
+                break;
+            case 'q':
+                trafego = true;
+                vias[SENSOR_VIA].taxa = atof(optarg) / 60000.0;
+                if (strchr(optarg, ','))
+                    vias[SENSOR_TRANSVERSAL].taxa = atof(strchr(optarg, ',') + 1) / 60000.0;
+                break;
+            case 'p':
+                periodo = strtoull(optarg, NULL, 10);
+                break;
+            case 'c':
+                custo_us = strtoull(optarg, NULL, 10);
+                break;
+            case 't':
+                trace = fopen(optarg, "w");
+                if (!trace) {
+                    perror(optarg);
+                    return 1;
+                }
+                fprintf(trace, "tempo_ms,saida,valor\n");
+                break;
+            default:
+                fprintf(stderr, "uso: %s [-d horas] [-b ms]... [-P plano[@ms]] [-q via,transversal] [-p ms] [-c us] [-t trace.csv]\n", argv[0]);
+                return 1;
+        }
+    }
+    // No polling o toque só é visto no tick seguinte da tarefa do botão
+    for (int i = 0; periodo && i < num_botoes; ++i)
+        botoes[i] = arredondar(botoes[i], periodo);
+    qsort(botoes, num_botoes, sizeof(botoes[0]), comparar);
+
+    uint64_t fim = (uint64_t)(horas * 3600 * 1000);
+    uint64_t proximo_semaforo = 0;
+    uint64_t proximo_display = 0;
+    uint64_t proximo_matriz = 0;
+    uint64_t ultimo_toque = 0;
+    uint64_t ultimo_despertar = 0;
+    bool display_ligado = true;
+    SemaforoEstado visto = {0};
+    SemaforoEstado matriz_vista = {.modo_noturno = true};
+    int botao = 0;
+    Semaforo semaforo;
+    semaforo_init(&semaforo, &saidas_simuladas, 0);
+    struct timespec t0, t1;
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+
+    for (int i = 0; trafego && i < HAL_ADC_CANAIS; ++i) {
+        if (vias[i].taxa > 0)
+            vias[i].proxima_chegada = intervalo_chegada(&semente, vias[i].taxa);
+    }
+
+    registrar(SAIDA_DISPLAY, 1);
+    while (relogio < fim) {
+        for (int i = 0; trafego && i < HAL_ADC_CANAIS; ++i)
+            avancar_fila(&vias[i], relogio);
+        bool tocou = botao < num_botoes && botoes[botao] == relogio;
+        if (plano >= 0 && relogio >= tempo_plano) {
+            semaforo_selecionar_plano(&semaforo, plano);
+            plano = -1;
+        }
+
+        // Cada passada do laço é um instante em que alguma tarefa acorda
+        if (!periodo && relogio - ultimo_despertar >= ESPERA_MINIMA_SONO) {
+            energia.dormindo_us += (relogio - ultimo_despertar) * 1000 - custo_us;
+            energia.sonos++;
+        }
+        ultimo_despertar = relogio;
+
+        if (relogio == proximo_semaforo || tocou) {
+            uint32_t espera;
+            if (periodo) {
+                // Firmware antigo: semáforo (prioridade 3) antes da tarefa do botão
+                semaforo_passo(&semaforo, (uint32_t)relogio);
+                if (tocou)
+                    semaforo_alternar_modo(&semaforo, (uint32_t)relogio);
+                espera = periodo;
+                despertares += 2;
+            } else {
+                // Tarefa acordada pelo prazo ou pela notificação do botão
+                if (tocou)
+                    semaforo_alternar_modo(&semaforo, (uint32_t)relogio);
+                espera = semaforo_passo(&semaforo, (uint32_t)relogio);
+                despertares++;
+            }
+            proximo_semaforo = relogio + (espera ? espera : 1);
+        }
+        SemaforoEstado estado;
+        semaforo_ler(&semaforo, &estado);
+
+        if (tocou) {
+            ultimo_toque = relogio;
+            if (periodo)
+                proximo_matriz = relogio;
+            if (!display_ligado) {
+                display_ligado = true;
+                registrar(SAIDA_DISPLAY, 1);
+            }
+        }
+        while (botao < num_botoes && botoes[botao] <= relogio)
+            botao++;
+        // O display acorda com o botão e com qualquer mudança que apareça na
+        // tela; a matriz, só com a mudança
+        bool mudou = mudanca_visivel(&estado, &visto);
+        if (!periodo && display_ligado && (tocou || mudou))
+            proximo_display = relogio;
+        if (!periodo && mudou)
+            proximo_matriz = relogio;
+        visto = estado;
+
+        if (relogio == proximo_display) {
+            registrar(SAIDA_SINAL, estado.exibindo_sinal);
+            quadros_display++;
+            if (periodo) {
+                proximo_display += TEMPO_ATUALIZACAO_DISPLAY;
+            } else if (estado.modo_noturno && relogio - ultimo_toque >= TEMPO_DISPLAY_NOTURNO) {
+                display_ligado = false;
+                registrar(SAIDA_DISPLAY, 0);
+                proximo_display = NUNCA;
+            } else {
+                proximo_display = cena_animada(cena_do_estado(&estado)) ? relogio + TEMPO_ATUALIZACAO_DISPLAY : NUNCA;
+            }
+        }
+        if (relogio == proximo_matriz) {
+            // O firmware antigo reenviava os 25 pixels a cada período, mesmo iguais
+            if (periodo || estado.modo_noturno != matriz_vista.modo_noturno || estado.estado != matriz_vista.estado ||
+                estado.contagem != matriz_vista.contagem)
+                quadros_matriz++;
+            matriz_vista = estado;
+            proximo_matriz = periodo ? relogio + TEMPO_ATUALIZACAO_MATRIZ : NUNCA;
+        }
+
+        relogio = menor(menor(proximo_semaforo, proximo_display), proximo_matriz);
+        if (botao < num_botoes)
+            relogio = menor(relogio, botoes[botao]);
+    }
+
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+    double segundos = (t1.tv_sec - t0.tv_sec) + (t1.tv_nsec - t0.tv_nsec) / 1e9;
+
+    printf("%.1f h simuladas em %.3f s (%.0f h/s), %llu eventos\n",
+           horas, segundos, segundos > 0 ? horas / segundos : 0, (unsigned long long)num_eventos);
+    printf("%.2f despertares/s das tarefas do semáforo e do botão\n", despertares / (horas * 3600));
+    printf("%.2f quadros/s desenhados no display\n", quadros_display / (horas * 3600));
+    printf("%.2f quadros/s enviados à matriz\n", quadros_matriz / (horas * 3600));
+    printf("energia: dormindo %.2f%% do tempo (%lu sonos de %llu us em média; %llu us, %lu sonos no total)\n",
+           fim ? 100.0 * energia.dormindo_us / (fim * 1000) : 0, (unsigned long)energia.sonos,
+           (unsigned long long)(energia.sonos ? energia.dormindo_us / energia.sonos : 0),
+           (unsigned long long)energia.dormindo_us, (unsigned long)energia.sonos);
+    printf("%-9s %12s %17s %17s\n", "saida", "ativacoes", "ligado min/max", "periodo min/max");
+    for (int i = 0; i < NUM_SAIDAS; ++i) {
+        const Registro *r = &registros[i];
+        printf("%-9s %12llu %8llu/%-8llu %8llu/%-8llu\n", r->nome, (unsigned long long)r->ativacoes,
+               (unsigned long long)r->ligado_min, (unsigned long long)r->ligado_max,
+               (unsigned long long)r->periodo_min, (unsigned long long)r->periodo_max);
+    }
+
+    if (trafego) {
+        uint64_t atendidos = 0, atraso = 0;
+        printf("\n%-12s %10s %10s %12s %9s\n", "aproximacao", "chegadas", "atendidos", "atraso medio", "fila max");
+        for (int i = 0; i < HAL_ADC_CANAIS; ++i) {
+            const Aproximacao *a = &vias[i];
+            printf("%-12s %10llu %10llu %10.1f s %9llu\n", a->nome, (unsigned long long)a->chegadas,
+                   (unsigned long long)a->atendidos, a->atendidos ? a->atraso_total / 1000.0 / a->atendidos : 0,
+                   (unsigned long long)a->fila_max);
+            atendidos += a->atendidos;
+            atraso += a->atraso_total;
+        }
+        printf("atraso medio %.1f s por carro, %.0f carros/h, ciclo medio %.1f s\n",
+               atendidos ? atraso / 1000.0 / atendidos : 0, atendidos / horas,
+               ciclos ? fim / 1000.0 / ciclos : 0);
+    }
+
+    if (trace)
+        fclose(trace);
+    return 0;
+}
@@ -0,0 +1,242 @@
+#include "semaforo.h"
+#include "sincronia.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+// Simulação da sincronia de ciclo entre placas (lib/sincronia.c) com cristais
+// imperfeitos, em tempo virtual. Uma mestra e N escravas rodam o plano
+// coordenado, cada uma no seu relógio: contador local = contador inicial +
+// t * (1 + ppm / 10^6), com o ppm sorteado em [-D, D]. Os contadores começam
+// perto da volta dos 32 bits de ms, que acontece no meio da simulação.
+//
+// A mestra gera o pulso nos múltiplos do período do seu contador; cada escrava
+// marca a borda no seu relógio com um atraso de interrupção sorteado em
+// [0, J] µs. O erro de cada cruzamento é medido quando o verde acende: quanto
+// o relógio da mestra (a rede) está longe da defasagem do cruzamento, módulo
+// o ciclo. A mesma simulação roda de novo sem pulsos, com as escravas
+// alinhadas à mão no instante 0, para comparar.
+//
+//   intellitraffic_sincronia [-d dias] [-n escravas] [-D ppm] [-J jitter_us]
+//                            [-m ciclos por pulso] [-a aquecimento_min]
+
+#define MAX_PLACAS 64
+#define MAX_DIAS 365
+#define DIA_US (86400.0 * 1e6)
+
+typedef struct {
+    Semaforo s;
+    Sincronia sinc;
+    double ppm;
+    uint64_t contador_inicial_us;
+    uint32_t defasagem;         // no relógio da rede
+    uint64_t prazo_us;          // próximo passo, no relógio local
+    double verde_aceso_ms;      // no relógio local; NAN antes do primeiro verde
+} Placa;
+
+typedef struct {
+    double erro_max;
+    double erro_quad;
+    uint64_t amostras;
+} Dia;
+
+typedef struct {
+    Dia dias[MAX_DIAS];
+    double verde_min, verde_max;
+} Medidas;
+
+static Placa placas[MAX_PLACAS];
+static uint n_placas;
+static uint32_t ciclo;
+static double tempo_real_us;
+static double aquecimento_us;
+static Medidas *medidas;
+
+static double local_us(const Placa *p, double t) {
+    return p->contador_inicial_us + t * (1 + p->ppm * 1e-6);
+}
+
+static double real_us(const Placa *p, double local) {
+    return (local - p->contador_inicial_us) / (1 + p->ppm * 1e-6);
+}
+
+static uint32_t sorteio = 12345;
+
+static double sortear(void) {
+    sorteio = sorteio * 1664525u + 1013904223u;
+    return (sorteio >> 8) / (double)(1u << 24);
+}
+
+static void luz_medida(void *ctx, uint id, Luz luz, bool acesa) {
+    if (luz != LUZ_VERDE)
+        return;
+    Placa *p = &placas[id];
+    double agora_ms = local_us(p, tempo_real_us) / 1000;
+    if (acesa)
+        p->verde_aceso_ms = agora_ms;
+    if (tempo_real_us < aquecimento_us)
+        return;
+
+    if (acesa) {
+        // O verde abre o ciclo: a rede deveria estar na defasagem
+        double rede_ms = local_us(&placas[0], tempo_real_us) / 1000;
+        double erro = fmod(rede_ms - p->defasagem, ciclo);
+        if (erro > ciclo / 2.0)
+            erro -= ciclo;
+        if (erro < -(ciclo / 2.0))
+            erro += ciclo;
+        Dia *d = &medidas->dias[(uint)(tempo_real_us / DIA_US)];
+        if (fabs(erro) > d->erro_max)
+            d->erro_max = fabs(erro);
+        d->erro_quad += erro * erro;
+        d->amostras++;
+    } else if (!isnan(p->verde_aceso_ms)) {
+        double verde = agora_ms - p->verde_aceso_ms;
+        if (verde < medidas->verde_min)
+            medidas->verde_min = verde;
+        if (verde > medidas->verde_max)
+            medidas->verde_max = verde;
+    }
+}
+
+static void buzzer_mudo(void *ctx, uint id, uint freq) {
+}
+
+static const SaidasSemaforo saidas_sincronia = {luz_medida, buzzer_mudo, NULL, NULL};
+
+static void preparar(double dias, double ppm, uint32_t periodo_ms) {
+    sorteio = 12345;
+    for (uint i = 0; i < n_placas; ++i) {
+        Placa *p = &placas[i];
+        p->ppm = (2 * sortear() - 1) * ppm;
+        // Entre 0 e dias antes da volta dos 32 bits de ms
+        uint64_t volta_ms = (uint64_t)1 << 32;
+        p->contador_inicial_us = (volta_ms - (uint64_t)(sortear() * dias * 86400e3)) * 1000;
+        p->defasagem = i * 2300 % ciclo;
+        p->prazo_us = (p->contador_inicial_us / 1000 + 1) * 1000;
+        p->verde_aceso_ms = NAN;
+        semaforo_init(&p->s, &saidas_sincronia, i);
+        semaforo_selecionar_plano(&p->s, PLANO_COORDENADO);
+        sincronia_init(&p->sinc, periodo_ms);
+    }
+}
+
+static void simular(double dias, double jitter_us, uint32_t periodo_ms, bool pulsos, Medidas *m) {
+    *m = (Medidas){.verde_min = INFINITY};
+    medidas = m;
+
+    // Sem pulsos, cada escrava parte com o desvio exato do instante 0
+    if (!pulsos) {
+        for (uint i = 1; i < n_placas; ++i) {
+            placas[i].sinc.desvio_us = (int64_t)(placas[0].contador_inicial_us - placas[i].contador_inicial_us);
+            placas[i].sinc.ultima_borda_us = placas[i].contador_inicial_us;
+        }
+    }
+
+    uint64_t periodo_us = (uint64_t)periodo_ms * 1000;
+    uint64_t pulso_us = (placas[0].contador_inicial_us / periodo_us + 1) * periodo_us;
+    double fim_us = dias * DIA_US;
+
+    while (1) {
+        Placa *proxima = NULL;
+        double t = pulsos ? real_us(&placas[0], pulso_us) : INFINITY;
+        for (uint i = 0; i < n_placas; ++i) {
+            double tp = real_us(&placas[i], placas[i].prazo_us);
+            if (tp < t) {
+                t = tp;
+                proxima = &placas[i];
+            }
+        }
+        if (t >= fim_us)
+            break;
+        tempo_real_us = t;
+
+        if (!proxima) {
+            for (uint i = 1; i < n_placas; ++i) {
+                uint64_t borda = (uint64_t)local_us(&placas[i], t) + (uint64_t)(sortear() * jitter_us);
+                sincronia_pulso(&placas[i].sinc, borda);
+            }
+            pulso_us += periodo_us;
+            continue;
+        }
+
+        // O mesmo que a tarefa do semáforo faz a cada passo
+        uint64_t agora_us = proxima->prazo_us;
+        semaforo_coordenar(&proxima->s, NULL, sincronia_defasagem_local(&proxima->sinc, proxima->defasagem, agora_us));
+        uint32_t espera = semaforo_passo(&proxima->s, (uint32_t)(agora_us / 1000));
+        proxima->prazo_us += (uint64_t)(espera ? espera : 1) * 1000;
+    }
+}
+
+static double rms(const Dia *d) {
+    return d->amostras ? sqrt(d->erro_quad / d->amostras) : 0;
+}
+
+int main(int argc, char **argv) {
+    double dias = 7;
+    double ppm = 50;
+    double jitter_us = 20;
+    double aquecimento_min = 60;
+    uint multiplo = 1;
+    int opt;
+
+    n_placas = 5;
+    while ((opt = getopt(argc, argv, "d:n:D:J:m:a:")) != -1) {
+        switch (opt) {
+            case 'd': dias = atof(optarg); break;
+            case 'n': n_placas = strtoul(optarg, NULL, 10) + 1; break;
+            case 'D': ppm = atof(optarg); break;
+            case 'J': jitter_us = atof(optarg); break;
+            case 'm': multiplo = strtoul(optarg, NULL, 10); break;
+            case 'a': aquecimento_min = atof(optarg); break;
+            default:
+                fprintf(stderr, "uso: %s [-d dias] [-n escravas] [-D ppm] [-J jitter_us] [-m ciclos] [-a minutos]\n",
+                        argv[0]);
+                return 1;
+        }
+    }
+    if (n_placas < 2 || n_placas > MAX_PLACAS || dias <= 0 || dias > MAX_DIAS || multiplo == 0 || ppm < 0 ||
+        jitter_us < 0) {
+        fprintf(stderr, "parâmetros inválidos\n");
+        return 1;
+    }
+
+    const PlanoTempo *p = &planos[PLANO_COORDENADO];
+    ciclo = 0;
+    for (int i = 0; i < p->num_fases; ++i)
+        ciclo += p->fases[i].duracao;
+    uint32_t periodo_ms = ciclo * multiplo;
+    aquecimento_us = aquecimento_min * 60e6;
+
+    static Medidas com, sem;
+    preparar(dias, ppm, periodo_ms);
+    simular(dias, jitter_us, periodo_ms, true, &com);
+    printf("mestra + %u escravas, ciclo %lu ms, pulso a cada %lu ms, cristais em ±%.0f ppm, atraso da borda até %.0f us\n",
+           n_placas - 1, (unsigned long)ciclo, (unsigned long)periodo_ms, ppm, jitter_us);
+    for (uint i = 1; i < n_placas; ++i) {
+        const Placa *e = &placas[i];
+        // rede - local anda (1 + ppm_mestra) / (1 + ppm_escrava) - 1 por µs local
+        double deriva_real = ((1 + placas[0].ppm * 1e-6) / (1 + e->ppm * 1e-6) - 1) * 1e6;
+        printf("  escrava %u: cristal %+7.2f ppm em relação à mestra, deriva estimada %+8.3f ppm (real %+8.3f), %lu pulsos, último erro %+ld us\n",
+               i, e->ppm - placas[0].ppm, e->sinc.deriva_ppb / 1e3, deriva_real, (unsigned long)e->sinc.pulsos,
+               (long)e->sinc.ultimo_erro_us);
+    }
+    printf("  verde entre %.0f e %.0f ms (mínimo do plano %u ms)\n", com.verde_min, com.verde_max,
+           p->fases[0].minimo);
+
+    preparar(dias, ppm, periodo_ms);
+    simular(dias, jitter_us, periodo_ms, false, &sem);
+
+    printf("erro do início de ciclo em relação à mestra (ms), depois de %.0f min\n", aquecimento_min);
+    printf("  dia   sincronizado: máximo   rms   |   livre: máximo     rms\n");
+    double pior = 0;
+    for (uint d = 0; d < dias; ++d) {
+        printf("  %3u %20.3f %7.3f   | %15.1f %9.1f\n", d + 1, com.dias[d].erro_max, rms(&com.dias[d]),
+               sem.dias[d].erro_max, rms(&sem.dias[d]));
+        if (com.dias[d].erro_max > pior)
+            pior = com.dias[d].erro_max;
+    }
+    printf("pior erro sincronizado: %.3f ms\n", pior);
+    return 0;
+}
@@ -0,0 +1,91 @@
+#include "host.h"
+#include "ssd1306.h"
+
+// Barramento I2C falso para o display: interpreta o fluxo de comandos e dados
+// como o SSD1306 (modo de endereçamento vertical) e guarda a GDDRAM em memória.
+
+static uint8_t gddram[WIDTH * SSD1306_MAX_PAGES];
+static size_t bus_bytes;
+static uint8_t cmd[3];
+static uint8_t num_cmd;
+static uint8_t col0, col1 = WIDTH - 1, page0, page1 = SSD1306_MAX_PAGES - 1;
+static uint8_t col, page;
+
+static void receber_comando(uint8_t b) {
+    cmd[num_cmd++] = b;
+    if (cmd[0] != SET_COL_ADDR && cmd[0] != SET_PAGE_ADDR) {
+        num_cmd = 0;
+        return;
+    }
+    if (num_cmd < 3)
+        return;
+    if (cmd[0] == SET_COL_ADDR) {
+        col0 = cmd[1];
+        col1 = cmd[2];
+    } else {
+        page0 = cmd[1];
+        page1 = cmd[2];
+    }
+    col = col0;
+    page = page0;
+    num_cmd = 0;
+}
+
+static void receber_dado(uint8_t b) {
+    gddram[col * SSD1306_MAX_PAGES + page] = b;
+    if (++page > page1) {
+        page = page0;
+        if (++col > col1)
+            col = col0;
+    }
+}
+
+static void host_write(void *ctx, uint8_t address, const uint8_t *src, size_t len) {
+    (void)ctx;
+    (void)address;
+    bus_bytes += len + 1;
+    size_t i = 0;
+    while (i < len) {
+        uint8_t controle = src[i++];
+        bool dado = controle & 0x40;
+        if (controle & 0x80) {
+            // Co = 1: um único byte segue este controle
+            if (i < len)
+                dado ? receber_dado(src[i++]) : receber_comando(src[i++]);
+        } else {
+            while (i < len)
+                dado ? receber_dado(src[i++]) : receber_comando(src[i++]);
+        }
+    }
+}
+
+// A transferência "assíncrona" termina na hora; done é chamado antes de retornar
+static void host_write_async(void *ctx, uint8_t address, const uint8_t *src, size_t len, ssd1306_done_cb_t done, void *arg) {
+    host_write(ctx, address, src, len);
+    done(arg, true);
+}
+
+void ssd1306_i2c_transport(ssd1306_transport_t *transport, i2c_inst_t *i2c) {
+    transport->write = host_write;
+    transport->write_async = NULL;
+    transport->prepare = NULL;
+    transport->abort = NULL;
+    transport->ctx = i2c;
+}
+
+void ssd1306_i2c_dma_init(ssd1306_t *ssd) {
+    ssd1306_transport_t transport = {
+        .write = host_write,
+        .write_async = host_write_async,
+        .ctx = ssd->i2c_port,
+    };
+    ssd1306_set_transport(ssd, &transport);
+}
+
+const uint8_t *ssd1306_host_gddram(void) {
+    return gddram;
+}
+
+size_t ssd1306_host_bus_bytes(void) {
+    return bus_bytes;
+}
@@ -0,0 +1,205 @@
+#include "host.h"
+#include "ssd1306.h"
+#include "bitmap.h"
+#include <stdio.h>
+#include <string.h>
+
+// Testes de imagem de referência das telas do display. Cada quadro em RLE e
+// cada passo das sequências de deltas (lib/bitmap_rle.c) é descompactado e
+// comparado com o quadro original de lib/bitmap.c. Depois cada quadro é
+// desenhado com ssd1306_blit, nas quatro operações, sobre outro quadro e numa
+// posição que corta as bordas e divide as colunas entre páginas; o buffer
+// resultante é comparado com as imagens de host/referencias (PBM, uma por
+// quadro, com as quatro operações empilhadas na ordem de ssd1306_rop_t).
+//
+//   teste_imagens host/referencias        confere
+//   teste_imagens -g host/referencias     regrava as referências
+
+#define QUADRO_BYTES (WIDTH * HEIGHT / 8)
+#define NUM_OPERACOES 4
+// Corta 19 colunas à esquerda e 13 linhas embaixo; y fora da página
+#define BLIT_X -19
+#define BLIT_Y 13
+
+static int falhas;
+
+#define CONFERIR(cond, ...)                                      \
+    do {                                                         \
+        if (!(cond)) {                                           \
+            printf("FALHA %s:%d: ", __FILE__, __LINE__);         \
+            printf(__VA_ARGS__);                                 \
+            printf("\n");                                        \
+            falhas++;                                            \
+        }                                                        \
+    } while (0)
+
+typedef struct {
+    const char *nome;
+    const unsigned char *original;
+    const unsigned char *rle;
+} Quadro;
+
+static const Quadro quadros[] = {
+    {"blindOne", epd_bitmap_blindOne, epd_rle_blindOne},
+    {"blindTwo", epd_bitmap_blindTwo, epd_rle_blindTwo},
+    {"blindThree", epd_bitmap_blindThree, epd_rle_blindThree},
+    {"sinal", epd_bitmap_sinal, epd_rle_sinal},
+    {"sinalPass", epd_bitmap_sinalPass, epd_rle_sinalPass},
+    {"sinalSStop", epd_bitmap_sinalSStop, epd_rle_sinalSStop},
+    {"noturnoOne", epd_bitmap_noturnoOne, epd_rle_noturnoOne},
+    {"noturnoTwo", epd_bitmap_noturnoTwo, epd_rle_noturnoTwo},
+    {"startFour", epd_bitmap_startFour, epd_rle_startFour},
+    {"startOne", epd_bitmap_startOne, epd_rle_startOne},
+    {"startPress", epd_bitmap_startPress, epd_rle_startPress},
+    {"startThree", epd_bitmap_startThree, epd_rle_startThree},
+    {"startTwo", epd_bitmap_startTwo, epd_rle_startTwo},
+};
+#define NUM_QUADROS (sizeof(quadros) / sizeof(quadros[0]))
+
+typedef struct {
+    const char *nome;
+    const bitmap_sequence_t *seq;
+    const unsigned char *quadros[3];
+} Sequencia;
+
+static const Sequencia sequencias[] = {
+    {"blind", &epd_seq_blind, {epd_bitmap_blindOne, epd_bitmap_blindTwo, epd_bitmap_blindThree}},
+    {"sinalVerde", &epd_seq_sinalVerde, {epd_bitmap_sinal, epd_bitmap_sinalPass}},
+    {"sinalVermelho", &epd_seq_sinalVermelho, {epd_bitmap_sinal, epd_bitmap_sinalSStop}},
+    {"noturno", &epd_seq_noturno, {epd_bitmap_noturnoOne, epd_bitmap_noturnoTwo}},
+    {"sinal", &epd_seq_sinal, {epd_bitmap_sinal}},
+    {"blindOne", &epd_seq_blindOne, {epd_bitmap_blindOne}},
+    {"blindThree", &epd_seq_blindThree, {epd_bitmap_blindThree}},
+};
+#define NUM_SEQUENCIAS (sizeof(sequencias) / sizeof(sequencias[0]))
+
+static ssd1306_t ssd;
+
+static const uint8_t *buffer(void) {
+    return ssd.ram_buffer + 1;
+}
+
+static void conferir_quadros(void) {
+    for (size_t i = 0; i < NUM_QUADROS; ++i) {
+        ssd1306_fill(&ssd, true);
+        ssd1306_draw_rle(&ssd, quadros[i].rle);
+        CONFERIR(memcmp(buffer(), quadros[i].original, QUADRO_BYTES) == 0, "RLE de %s diferente do original",
+                 quadros[i].nome);
+    }
+}
+
+// Percorre cada sequência uma volta inteira: o último delta volta ao primeiro quadro
+static void conferir_sequencias(void) {
+    for (size_t i = 0; i < NUM_SEQUENCIAS; ++i) {
+        const Sequencia *s = &sequencias[i];
+        ssd1306_draw_rle(&ssd, s->seq->base);
+        CONFERIR(memcmp(buffer(), s->quadros[0], QUADRO_BYTES) == 0, "%s: quadro 0 diferente", s->nome);
+        if (s->seq->num_frames < 2)
+            continue;
+        for (uint8_t q = 1; q <= s->seq->num_frames; ++q) {
+            ssd1306_apply_delta(&ssd, s->seq->deltas[q - 1]);
+            uint8_t esperado = q % s->seq->num_frames;
+            CONFERIR(memcmp(buffer(), s->quadros[esperado], QUADRO_BYTES) == 0, "%s: delta %u diferente do quadro %u",
+                     s->nome, q - 1, esperado);
+        }
+    }
+}
+
+// Imagem PBM binária: linhas de cima para baixo, 1 = pixel aceso
+static bool pixel(const uint8_t *quadro, int x, int y) {
+    return quadro[x * (HEIGHT / 8) + y / 8] & (1 << (y & 7));
+}
+
+static bool gravar_pbm(const char *caminho, uint8_t imagens[][QUADRO_BYTES], int n) {
+    FILE *f = fopen(caminho, "wb");
+    if (!f)
+        return false;
+    fprintf(f, "P4\n%d %d\n", WIDTH, HEIGHT * n);
+    for (int i = 0; i < n; ++i)
+        for (int y = 0; y < HEIGHT; ++y)
+            for (int x = 0; x < WIDTH; x += 8) {
+                uint8_t b = 0;
+                for (int k = 0; k < 8; ++k)
+                    b |= pixel(imagens[i], x + k, y) << (7 - k);
+                fputc(b, f);
+            }
+    return fclose(f) == 0;
+}
+
+static bool ler_pbm(const char *caminho, uint8_t imagens[][QUADRO_BYTES], int n) {
+    FILE *f = fopen(caminho, "rb");
+    if (!f)
+        return false;
+    int w, h;
+    bool ok = fscanf(f, "P4 %d %d", &w, &h) == 2 && fgetc(f) == '\n' && w == WIDTH && h == HEIGHT * n;
+    memset(imagens, 0, (size_t)n * QUADRO_BYTES);
+    for (int i = 0; ok && i < n; ++i)
+        for (int y = 0; ok && y < HEIGHT; ++y)
+            for (int x = 0; x < WIDTH; x += 8) {
+                int b = fgetc(f);
+                if (b == EOF) {
+                    ok = false;
+                    break;
+                }
+                for (int k = 0; k < 8; ++k)
+                    if (b & (0x80 >> k))
+                        imagens[i][(x + k) * (HEIGHT / 8) + y / 8] |= 1 << (y & 7);
+            }
+    fclose(f);
+    return ok;
+}
+
+static bool conferir_blits(const char *dir, bool gravar) {
+    static const char *const operacoes[NUM_OPERACOES] = {"REPLACE", "OR", "AND", "XOR"};
+    static uint8_t origem[QUADRO_BYTES];
+    static uint8_t obtido[NUM_OPERACOES][QUADRO_BYTES], esperado[NUM_OPERACOES][QUADRO_BYTES];
+    char caminho[512];
+
+    for (size_t i = 0; i < NUM_QUADROS; ++i) {
+        ssd1306_draw_rle(&ssd, quadros[i].rle);
+        memcpy(origem, buffer(), QUADRO_BYTES);
+        // Fundo: o quadro seguinte da lista
+        for (int op = 0; op < NUM_OPERACOES; ++op) {
+            ssd1306_draw_rle(&ssd, quadros[(i + 1) % NUM_QUADROS].rle);
+            ssd1306_blit(&ssd, origem, WIDTH, HEIGHT, BLIT_X, BLIT_Y, (ssd1306_rop_t)op);
+            memcpy(obtido[op], buffer(), QUADRO_BYTES);
+        }
+
+        snprintf(caminho, sizeof(caminho), "%s/%s.pbm", dir, quadros[i].nome);
+        if (gravar) {
+            if (!gravar_pbm(caminho, obtido, NUM_OPERACOES)) {
+                printf("não foi possível gravar %s\n", caminho);
+                return false;
+            }
+            continue;
+        }
+        if (!ler_pbm(caminho, esperado, NUM_OPERACOES)) {
+            printf("não foi possível ler %s\n", caminho);
+            return false;
+        }
+        for (int op = 0; op < NUM_OPERACOES; ++op)
+            CONFERIR(memcmp(obtido[op], esperado[op], QUADRO_BYTES) == 0, "blit de %s com %s diferente da referência",
+                     quadros[i].nome, operacoes[op]);
+    }
+    return true;
+}
+
+int main(int argc, char **argv) {
+    bool gravar = argc == 3 && strcmp(argv[1], "-g") == 0;
+    if (argc != 2 && !gravar) {
+        fprintf(stderr, "uso: %s [-g] diretório_das_referências\n", argv[0]);
+        return 1;
+    }
+    ssd1306_init(&ssd, WIDTH, HEIGHT, false, 0x3C, NULL);
+
+    conferir_quadros();
+    conferir_sequencias();
+    if (!conferir_blits(argv[argc - 1], gravar))
+        return 1;
+
+    if (falhas)
+        printf("%d falhas\n", falhas);
+    else
+        printf("imagens: ok%s\n", gravar ? " (referências gravadas)" : "");
+    return falhas != 0;
+}
@@ -0,0 +1,394 @@
+#include "semaforo.h"
+#include <stdio.h>
+#include <string.h>
+
+// Testes da máquina de estados (lib/semaforo.c) em tempo virtual. O motor é
+// avançado como na tarefa do semáforo, de prazo em prazo pelo retorno de
+// semaforo_passo, e o que ele deixa nas saídas e no estado publicado vale até
+// o passo seguinte. Essa linha do tempo, ms a ms, é comparada com a montada a
+// partir da tabela de planos: fase, luzes, buzzer, sinal de pedestre e
+// contagem regressiva. Uma diferença quer dizer que o motor mudou algo fora do
+// tempo ou que um prazo não foi devolvido.
+
+static int falhas;
+
+#define CONFERIR(cond, ...)                                      \
+    do {                                                         \
+        if (!(cond)) {                                           \
+            printf("FALHA %s:%d: ", __FILE__, __LINE__);         \
+            printf(__VA_ARGS__);                                 \
+            printf("\n");                                        \
+            falhas++;                                            \
+        }                                                        \
+    } while (0)
+
+#define HORIZONTE 60000
+
+// O que se vê num ms
+typedef struct {
+    PlanoId plano;
+    uint8_t fase;
+    bool luz[NUM_LUZES];
+    uint16_t buzzer;
+    bool sinal;
+    uint8_t contagem;
+} Amostra;
+
+static Amostra obtido[HORIZONTE], esperado[HORIZONTE];
+
+// Saídas do motor
+static bool luzes[NUM_LUZES];
+static uint16_t buzzer;
+static uint16_t filas[2];
+
+static void luz_teste(void *ctx, uint id, Luz luz, bool acesa) {
+    luzes[luz] = acesa;
+}
+
+static void buzzer_teste(void *ctx, uint id, uint freq) {
+    buzzer = freq;
+}
+
+static uint16_t sensor_teste(void *ctx, uint id, uint canal) {
+    return filas[canal];
+}
+
+static const SaidasSemaforo saidas_teste = {luz_teste, buzzer_teste, sensor_teste, NULL};
+
+#define FILA_CHEIA 4000
+#define FILA_VAZIA 0
+
+static Semaforo semaforo;
+
+// Semáforo novo com o plano dado, pedido antes do primeiro passo
+static void iniciar(PlanoId plano, uint16_t fila_via, uint16_t fila_transversal) {
+    memset(luzes, 0, sizeof(luzes));
+    buzzer = 0;
+    filas[SENSOR_VIA] = fila_via;
+    filas[SENSOR_TRANSVERSAL] = fila_transversal;
+    semaforo_init(&semaforo, &saidas_teste, 0);
+    semaforo_selecionar_plano(&semaforo, plano);
+}
+
+// Troca de plano pedida por outra tarefa em t = quando
+typedef struct {
+    uint32_t quando;
+    PlanoId plano;
+} Pedido;
+
+// Avança de prazo em prazo a partir de inicio e preenche obtido. Um pedido de
+// plano ganha um passo próprio no instante dele.
+static void rodar_com_pedido(uint32_t inicio, const Pedido *pedido) {
+    uint32_t t = 0;
+    while (t < HORIZONTE) {
+        if (pedido && t == pedido->quando)
+            semaforo_selecionar_plano(&semaforo, pedido->plano);
+        uint32_t espera = semaforo_passo(&semaforo, inicio + t);
+        if (espera == 0)
+            espera = 1;
+        if (pedido && t < pedido->quando && pedido->quando - t < espera)
+            espera = pedido->quando - t;
+        SemaforoEstado e;
+        semaforo_ler(&semaforo, &e);
+        Amostra a = {e.plano, e.fase, {luzes[0], luzes[1], luzes[2]}, buzzer, e.exibindo_sinal, e.contagem};
+        for (uint32_t fim = t + espera < HORIZONTE ? t + espera : HORIZONTE; t < fim; ++t)
+            obtido[t] = a;
+    }
+}
+
+static void rodar(uint32_t inicio) {
+    rodar_com_pedido(inicio, NULL);
+}
+
+// Frequência do buzzer num instante da fase: começa ligado ou não e alterna
+// pelos tempos do bipe
+static uint16_t bipe_em(const BipeFase *b, uint32_t decorrido) {
+    if (!b->freq)
+        return 0;
+    bool ligado = b->comeca_ligado;
+    for (uint32_t t = 0;; ligado = !ligado) {
+        t += ligado ? b->ligado : b->desligado;
+        if (decorrido < t)
+            return ligado ? b->freq : 0;
+    }
+}
+
+// Uma fase do plano com a duração dada, a partir de inicio. O sinal de
+// pedestre fica TEMPO_EXIBICAO_SINAL desde a entrada, mesmo se a fase acabar
+// antes. Retorna o fim da fase.
+static uint32_t esperar_fase(PlanoId plano, uint8_t fase, uint32_t duracao, uint32_t inicio) {
+    const PlanoTempo *p = &planos[plano];
+    const FasePlano *f = &p->fases[fase];
+    uint32_t horizonte = f->atuada ? f->minimo : duracao;
+    for (uint32_t d = 0; d < duracao && inicio + d < HORIZONTE; ++d) {
+        Amostra *a = &esperado[inicio + d];
+        uint32_t falta = d < horizonte ? horizonte - d : 0;
+        bool sinal = a->sinal;
+        *a = (Amostra){plano, fase, {f->vermelho, f->amarelo, f->verde}, bipe_em(&f->bipe, d), sinal,
+                       p->noturno ? 0 : (falta + 999) / 1000};
+    }
+    if (f->sinal)
+        for (uint32_t d = 0; d < TEMPO_EXIBICAO_SINAL && inicio + d < HORIZONTE; ++d)
+            esperado[inicio + d].sinal = true;
+    return inicio + duracao;
+}
+
+// Um ciclo do plano com as durações dadas por fase (NULL: as da tabela), a
+// partir de inicio; retorna o fim do ciclo
+static uint32_t esperar_ciclo(PlanoId plano, const uint32_t *duracoes, uint32_t inicio) {
+    const PlanoTempo *p = &planos[plano];
+    for (uint8_t i = 0; i < p->num_fases; ++i)
+        inicio = esperar_fase(plano, i, duracoes ? duracoes[i] : p->fases[i].duracao, inicio);
+    return inicio;
+}
+
+// Ciclos do plano até o horizonte
+static void esperar_ciclos(PlanoId plano, const uint32_t *duracoes, uint32_t inicio) {
+    while (inicio < HORIZONTE)
+        inicio = esperar_ciclo(plano, duracoes, inicio);
+}
+
+// Primeira diferença entre as linhas do tempo, campo a campo
+static void comparar(const char *caso) {
+    for (uint32_t t = 0; t < HORIZONTE; ++t) {
+        const Amostra *o = &obtido[t], *e = &esperado[t];
+        const char *campo = NULL;
+        if (o->plano != e->plano || o->fase != e->fase)
+            campo = "fase";
+        else if (memcmp(o->luz, e->luz, sizeof(o->luz)) != 0)
+            campo = "luzes";
+        else if (o->buzzer != e->buzzer)
+            campo = "buzzer";
+        else if (o->sinal != e->sinal)
+            campo = "sinal de pedestre";
+        else if (o->contagem != e->contagem)
+            campo = "contagem";
+        if (campo) {
+            CONFERIR(false, "%s: %s diferente em t = %u ms (plano %d fase %u, esperado plano %d fase %u; "
+                     "buzzer %u/%u, contagem %u/%u)", caso, campo, t, o->plano, o->fase, e->plano, e->fase,
+                     o->buzzer, e->buzzer, o->contagem, e->contagem);
+            return;
+        }
+    }
+}
+
+static void limpar_esperado(void) {
+    memset(esperado, 0, sizeof(esperado));
+}
+
+// Cada plano de ciclo fixo, pelos tempos da tabela
+static void conferir_planos_fixos(void) {
+    static const PlanoId fixos[] = {PLANO_FORA_PICO, PLANO_PICO, PLANO_COORDENADO, PLANO_NOTURNO};
+    for (size_t i = 0; i < sizeof(fixos) / sizeof(fixos[0]); ++i) {
+        iniciar(fixos[i], FILA_CHEIA, FILA_CHEIA);
+        rodar(0);
+        limpar_esperado();
+        esperar_ciclos(fixos[i], NULL, 0);
+        comparar(planos[fixos[i]].nome);
+    }
+}
+
+// Plano atuado: com as duas filas cheias cada verde vai ao máximo; a fase cuja
+// fila esvaziou acaba no mínimo se a outra espera
+static void conferir_atuado(void) {
+    const FasePlano *f = planos[PLANO_ATUADO].fases;
+
+    iniciar(PLANO_ATUADO, FILA_CHEIA, FILA_CHEIA);
+    rodar(0);
+    limpar_esperado();
+    esperar_ciclos(PLANO_ATUADO, NULL, 0);
+    comparar("atuado com as duas filas");
+
+    iniciar(PLANO_ATUADO, FILA_VAZIA, FILA_CHEIA);
+    rodar(0);
+    limpar_esperado();
+    esperar_ciclos(PLANO_ATUADO, (const uint32_t[]){f[0].minimo, f[1].duracao, f[2].duracao}, 0);
+    comparar("atuado sem fila na via");
+
+    iniciar(PLANO_ATUADO, FILA_CHEIA, FILA_VAZIA);
+    rodar(0);
+    limpar_esperado();
+    esperar_ciclos(PLANO_ATUADO, (const uint32_t[]){f[0].duracao, f[1].duracao, f[2].minimo}, 0);
+    comparar("atuado sem fila na transversal");
+
+    // Sem fila em nenhuma: ninguém espera, cada fase vai ao máximo
+    iniciar(PLANO_ATUADO, FILA_VAZIA, FILA_VAZIA);
+    rodar(0);
+    limpar_esperado();
+    esperar_ciclos(PLANO_ATUADO, NULL, 0);
+    comparar("atuado sem fila");
+}
+
+// Cadência do noturno em números: amarelo aceso no segundo ímpar, beep de
+// 100 ms a 1500 Hz no início de cada apagada, um a cada 2 s
+static void conferir_cadencia_noturna(void) {
+    iniciar(PLANO_NOTURNO, FILA_CHEIA, FILA_CHEIA);
+    rodar(0);
+    for (uint32_t t = 0; t < HORIZONTE; ++t) {
+        bool aceso = t % 2000 >= 1000;
+        uint16_t bipe = t % 2000 < 100 ? 1500 : 0;
+        if (obtido[t].luz[LUZ_AMARELA] != aceso || obtido[t].buzzer != bipe || obtido[t].luz[LUZ_VERMELHA] ||
+            obtido[t].luz[LUZ_VERDE] || obtido[t].contagem) {
+            CONFERIR(false, "noturno: em t = %u ms amarelo %d e buzzer %u, esperado %d e %u", t,
+                     obtido[t].luz[LUZ_AMARELA], obtido[t].buzzer, aceso, bipe);
+            return;
+        }
+    }
+}
+
+// Cópia da tabela de planos de lib/semaforo.c: um tempo mudado lá tem de ser
+// mudado aqui também, de propósito
+typedef struct {
+    EstadoSemaforo indicacao;
+    uint16_t duracao;
+    bool vermelho, amarelo, verde, sinal;
+    BipeFase bipe;
+    bool atuada;
+    uint16_t minimo;
+    uint8_t sensor, oposto;
+} FaseDocumentada;
+
+#define BIPE_VERDE {2000, 100, 900, true}
+#define BIPE_AMARELO {3000, 100, 100, true}
+#define BIPE_VERMELHO {1000, 500, 1500, false}
+
+static const struct {
+    bool noturno, coordenado;
+    uint8_t num_fases;
+    FaseDocumentada fases[MAX_FASES_PLANO];
+} planos_documentados[NUM_PLANOS] = {
+    [PLANO_FORA_PICO] = {false, false, 3, {
+        {ESTADO_VERDE, 5000, .verde = true, .sinal = true, .bipe = BIPE_VERDE},
+        {ESTADO_AMARELO, 2000, .amarelo = true, .bipe = BIPE_AMARELO},
+        {ESTADO_VERMELHO, 5000, .vermelho = true, .sinal = true, .bipe = BIPE_VERMELHO},
+    }},
+    [PLANO_PICO] = {false, false, 3, {
+        {ESTADO_VERDE, 8000, .verde = true, .sinal = true, .bipe = BIPE_VERDE},
+        {ESTADO_AMARELO, 2000, .amarelo = true, .bipe = BIPE_AMARELO},
+        {ESTADO_VERMELHO, 4000, .vermelho = true, .sinal = true, .bipe = BIPE_VERMELHO},
+    }},
+    [PLANO_ATUADO] = {false, false, 3, {
+        {ESTADO_VERDE, 10000, .verde = true, .sinal = true, .bipe = BIPE_VERDE, .atuada = true, .minimo = 3000,
+         .sensor = SENSOR_VIA, .oposto = SENSOR_TRANSVERSAL},
+        {ESTADO_AMARELO, 2000, .amarelo = true, .bipe = BIPE_AMARELO},
+        {ESTADO_VERMELHO, 10000, .vermelho = true, .sinal = true, .bipe = BIPE_VERMELHO, .atuada = true,
+         .minimo = 3000, .sensor = SENSOR_TRANSVERSAL, .oposto = SENSOR_VIA},
+    }},
+    [PLANO_COORDENADO] = {false, true, 3, {
+        {ESTADO_VERDE, 6000, .verde = true, .sinal = true, .bipe = BIPE_VERDE, .minimo = 3000},
+        {ESTADO_AMARELO, 2000, .amarelo = true, .bipe = BIPE_AMARELO},
+        {ESTADO_VERMELHO, 6000, .vermelho = true, .sinal = true, .bipe = BIPE_VERMELHO},
+    }},
+    [PLANO_NOTURNO] = {true, false, 2, {
+        {ESTADO_AMARELO, 1000, .bipe = {1500, 100, 1900, true}},
+        {ESTADO_AMARELO, 1000, .amarelo = true},
+    }},
+};
+
+static bool mesmo_bipe(const BipeFase *a, const BipeFase *b) {
+    return a->freq == b->freq && a->ligado == b->ligado && a->desligado == b->desligado &&
+           a->comeca_ligado == b->comeca_ligado;
+}
+
+static void conferir_tabela(void) {
+    for (int i = 0; i < NUM_PLANOS; ++i) {
+        const PlanoTempo *p = &planos[i];
+        CONFERIR(p->noturno == planos_documentados[i].noturno && p->coordenado == planos_documentados[i].coordenado &&
+                 p->num_fases == planos_documentados[i].num_fases, "%s: tipo ou número de fases mudou", p->nome);
+        for (uint8_t k = 0; k < p->num_fases && k < planos_documentados[i].num_fases; ++k) {
+            const FasePlano *f = &p->fases[k];
+            const FaseDocumentada *d = &planos_documentados[i].fases[k];
+            CONFERIR(f->indicacao == d->indicacao && f->duracao == d->duracao, "%s, fase %u: %u ms, documentado %u ms",
+                     p->nome, k, f->duracao, d->duracao);
+            CONFERIR(f->vermelho == d->vermelho && f->amarelo == d->amarelo && f->verde == d->verde &&
+                     f->sinal == d->sinal, "%s, fase %u: luzes ou sinal mudaram", p->nome, k);
+            CONFERIR(mesmo_bipe(&f->bipe, &d->bipe), "%s, fase %u: bipe mudou", p->nome, k);
+            CONFERIR(f->atuada == d->atuada && f->minimo == d->minimo && f->sensor == d->sensor &&
+                     f->oposto == d->oposto, "%s, fase %u: atuação ou mínimo mudaram", p->nome, k);
+        }
+    }
+}
+
+// semaforo_selecionar_plano só vale na virada do ciclo, mesmo pedido no meio
+// da última fase; pedido logo depois da virada espera o ciclo seguinte
+static void conferir_troca_de_plano(void) {
+    static const struct {
+        const char *caso;
+        Pedido pedido;
+        uint8_t ciclos_antes;
+    } casos[] = {
+        {"pico pedido no verde", {1000, PLANO_PICO}, 1},
+        {"pico pedido no último ms do ciclo", {11999, PLANO_PICO}, 1},
+        {"pico pedido na virada", {12000, PLANO_PICO}, 1},
+        {"pico pedido logo depois da virada", {12001, PLANO_PICO}, 2},
+        {"noturno pedido no vermelho", {9000, PLANO_NOTURNO}, 1},
+        {"atuado pedido no amarelo", {5500, PLANO_ATUADO}, 1},
+    };
+    for (size_t i = 0; i < sizeof(casos) / sizeof(casos[0]); ++i) {
+        iniciar(PLANO_FORA_PICO, FILA_CHEIA, FILA_CHEIA);
+        rodar_com_pedido(0, &casos[i].pedido);
+        limpar_esperado();
+        uint32_t virada = 0;
+        for (uint8_t c = 0; c < casos[i].ciclos_antes; ++c)
+            virada = esperar_ciclo(PLANO_FORA_PICO, NULL, virada);
+        esperar_ciclos(casos[i].pedido.plano, NULL, virada);
+        comparar(casos[i].caso);
+    }
+}
+
+// Plano coordenado começando fora da defasagem: a primeira fase absorve o
+// atraso sem ficar abaixo de COORDENADO_VERDE_MINIMO e os ciclos seguintes
+// começam em defasagem + k * ciclo
+#define INICIO_COORDENADO 100000
+#define CICLO_COORDENADO (COORDENADO_VERDE + COORDENADO_AMARELO + COORDENADO_VERMELHO)
+
+static void conferir_coordenado(void) {
+    static const struct {
+        const char *caso;
+        uint32_t atraso;
+        uint32_t verdes[2];   // verde dos dois primeiros ciclos
+    } casos[] = {
+        {"atraso dentro da folga do verde", 2000, {COORDENADO_VERDE - 2000, COORDENADO_VERDE}},
+        {"atraso maior que a folga do verde", 5000,
+         {COORDENADO_VERDE_MINIMO, COORDENADO_VERDE - (5000 - (COORDENADO_VERDE - COORDENADO_VERDE_MINIMO))}},
+        {"atraso de mais de meio ciclo", 10000, {COORDENADO_VERDE + CICLO_COORDENADO - 10000, COORDENADO_VERDE}},
+    };
+    for (size_t i = 0; i < sizeof(casos) / sizeof(casos[0]); ++i) {
+        iniciar(PLANO_COORDENADO, FILA_CHEIA, FILA_CHEIA);
+        semaforo_coordenar(&semaforo, NULL, INICIO_COORDENADO - casos[i].atraso);
+        rodar(INICIO_COORDENADO);
+        limpar_esperado();
+        uint32_t t = 0;
+        for (int c = 0; c < 2; ++c)
+            t = esperar_ciclo(PLANO_COORDENADO, (const uint32_t[]){casos[i].verdes[c], COORDENADO_AMARELO,
+                                                                   COORDENADO_VERMELHO}, t);
+        esperar_ciclos(PLANO_COORDENADO, NULL, t);
+        comparar(casos[i].caso);
+
+        // Nenhum verde inteiro abaixo do mínimo
+        uint32_t inicio_verde = 0;
+        for (uint32_t k = 1; k < HORIZONTE; ++k) {
+            bool verde = obtido[k].luz[LUZ_VERDE], antes = obtido[k - 1].luz[LUZ_VERDE];
+            if (verde && !antes)
+                inicio_verde = k;
+            if (!verde && antes)
+                CONFERIR(k - inicio_verde >= COORDENADO_VERDE_MINIMO, "%s: verde de %u ms em t = %u ms",
+                         casos[i].caso, k - inicio_verde, inicio_verde);
+        }
+    }
+}
+
+int main(void) {
+    conferir_tabela();
+    conferir_planos_fixos();
+    conferir_atuado();
+    conferir_cadencia_noturna();
+    conferir_troca_de_plano();
+    conferir_coordenado();
+
+    if (falhas)
+        printf("%d falhas\n", falhas);
+    else
+        printf("semaforo: ok\n");
+    return falhas != 0;
+}
@@ -0,0 +1,234 @@
+#include "host.h"
+#include "ssd1306.h"
+#include "tela.h"
+#include <stdio.h>
+#include <string.h>
+
+// Testes do envio por páginas sujas de lib/ssd1306.c sobre o barramento falso
+// de host/ssd1306_host.c: quantos bytes cada envio põe no barramento e se a
+// GDDRAM simulada termina igual ao buffer. Também confere que um envio que
+// falha ou é abandonado libera o driver e faz o próximo quadro ir inteiro.
+// Por fim mede o envio das telas do firmware (lib/tela.c) nas trocas de cena,
+// nos quadros das animações e nos passos da contagem.
+
+static int falhas;
+
+#define CONFERIR(cond, ...)                                      \
+    do {                                                         \
+        if (!(cond)) {                                           \
+            printf("FALHA %s:%d: ", __FILE__, __LINE__);         \
+            printf(__VA_ARGS__);                                 \
+            printf("\n");                                        \
+            falhas++;                                            \
+        }                                                        \
+    } while (0)
+
+// Uma transação com a janela de colunas x páginas: o byte de endereço do I2C,
+// os comandos de endereçamento e os dados
+#define JANELA(colunas, paginas) (1 + SSD1306_WINDOW_HEADER + (colunas) * (paginas))
+
+static ssd1306_t ssd;
+
+static size_t enviar(void) {
+    size_t antes = ssd1306_host_bus_bytes();
+    ssd1306_send_data(&ssd);
+    return ssd1306_host_bus_bytes() - antes;
+}
+
+static void conferir_envio(const char *caso, size_t esperado) {
+    size_t bytes = enviar();
+    CONFERIR(bytes == esperado, "%s: %zu bytes, esperado %zu", caso, bytes, (size_t)esperado);
+    CONFERIR(memcmp(ssd1306_host_gddram(), ssd.ram_buffer + 1, ssd.bufsize - 1) == 0,
+             "%s: GDDRAM diferente do buffer", caso);
+}
+
+// Envio de uma tela do firmware: o tamanho medido e, como teto, uma janela
+// por página alterada (o que o envio faria sem juntar páginas)
+static void conferir_tela(const char *caso, size_t esperado) {
+    size_t teto = 0;
+    for (uint8_t p = 0; p < SSD1306_MAX_PAGES; ++p) {
+        int x0 = -1, x1 = -1;
+        for (int x = 0; x < WIDTH; ++x) {
+            size_t i = x * SSD1306_MAX_PAGES + p;
+            if (ssd.ram_buffer[1 + i] != ssd1306_host_gddram()[i]) {
+                if (x0 < 0)
+                    x0 = x;
+                x1 = x;
+            }
+        }
+        if (x0 >= 0)
+            teto += JANELA(x1 - x0 + 1, 1);
+    }
+    size_t antes = ssd1306_host_bus_bytes();
+    conferir_envio(caso, esperado);
+    size_t bytes = ssd1306_host_bus_bytes() - antes;
+    CONFERIR(bytes <= teto, "%s: %zu bytes, mais que uma janela por página (%zu)", caso, bytes, teto);
+}
+
+typedef struct {
+    const char *caso;
+    SemaforoEstado estado;
+    uint32_t agora;
+    size_t bytes;
+} PassoTela;
+
+// Bytes medidos com os bitmaps atuais; mudam se as telas mudarem
+static const PassoTela passos_tela[] = {
+    {"cena vermelha", {.estado = ESTADO_VERMELHO}, 0, 633},
+    {"contagem na cena vermelha", {.estado = ESTADO_VERMELHO, .contagem = 12}, 10, 74},
+    {"passo da contagem", {.estado = ESTADO_VERMELHO, .contagem = 11}, 1010, 42},
+    {"passo da contagem nos dois dígitos", {.estado = ESTADO_VERMELHO, .contagem = 9}, 3010, 74},
+    {"fim da contagem", {.estado = ESTADO_VERMELHO}, 4010, 42},
+    {"troca para verde", {.estado = ESTADO_VERDE}, 5000, 183},
+    {"quadro da animação do verde", {.estado = ESTADO_VERDE}, 5300, 203},
+    {"segundo quadro do verde", {.estado = ESTADO_VERDE}, 5900, 184},
+    {"troca para amarelo", {.estado = ESTADO_AMARELO}, 6000, 179},
+    {"sinal de pedestre", {.estado = ESTADO_VERMELHO, .exibindo_sinal = true}, 7000, 578},
+    {"quadro do sinal", {.estado = ESTADO_VERMELHO, .exibindo_sinal = true}, 7250, 246},
+    {"cena noturna", {.modo_noturno = true, .estado = ESTADO_AMARELO}, 8000, 779},
+    {"quadro da cena noturna", {.modo_noturno = true, .estado = ESTADO_AMARELO}, 8500, 309},
+};
+#define NUM_PASSOS_TELA (sizeof(passos_tela) / sizeof(passos_tela[0]))
+
+static void conferir_telas(void) {
+    Tela tela = {0};
+    ssd1306_fill(&ssd, false);
+    ssd1306_send_data(&ssd);
+    for (size_t i = 0; i < NUM_PASSOS_TELA; ++i) {
+        const PassoTela *p = &passos_tela[i];
+        CONFERIR(tela_atualizar(&tela, &ssd, &p->estado, p->agora), "%s: tela sem mudança", p->caso);
+        conferir_tela(p->caso, p->bytes);
+    }
+}
+
+static int quadros, quadros_falhos;
+
+static void quadro_enviado(void *arg, bool ok) {
+    (void)arg;
+    if (ok)
+        quadros++;
+    else
+        quadros_falhos++;
+}
+
+// Transportes de teste: um em que o painel não confirma nada (NACK) e outro
+// em que a transação nunca termina até ser abandonada
+static int preparados, transacoes, abandonos;
+
+static void escrever_nada(void *ctx, uint8_t address, const uint8_t *src, size_t len) {
+}
+
+static void preparar(void *ctx, const uint8_t *src, size_t len) {
+    preparados++;
+}
+
+static void escrever_sem_resposta(void *ctx, uint8_t address, const uint8_t *src, size_t len,
+                                  ssd1306_done_cb_t done, void *arg) {
+    transacoes++;
+    done(arg, false);
+}
+
+static void escrever_preso(void *ctx, uint8_t address, const uint8_t *src, size_t len, ssd1306_done_cb_t done,
+                           void *arg) {
+    transacoes++;
+}
+
+static void abandonar(void *ctx) {
+    abandonos++;
+}
+
+int main(void) {
+    ssd1306_init(&ssd, WIDTH, HEIGHT, false, 0x3C, NULL);
+
+    conferir_envio("primeiro envio", JANELA(WIDTH, SSD1306_MAX_PAGES));
+    conferir_envio("quadro sem mudança", 0);
+
+    ssd1306_pixel(&ssd, 10, 20, true);
+    conferir_envio("um pixel", JANELA(1, 1));
+
+    ssd1306_pixel(&ssd, 10, 20, true);
+    conferir_envio("pixel com o mesmo valor", 0);
+
+    ssd1306_pixel(&ssd, 50, 30, true);
+    ssd1306_pixel(&ssd, 50, 30, false);
+    conferir_envio("pixel aceso e apagado antes do envio", 0);
+
+    ssd1306_pixel(&ssd, 5, 40, true);
+    ssd1306_pixel(&ssd, 100, 41, true);
+    conferir_envio("dois pixels na mesma página", JANELA(96, 1));
+
+    ssd1306_pixel(&ssd, 0, 0, true);
+    ssd1306_pixel(&ssd, 127, 63, true);
+    conferir_envio("páginas separadas", 2 * JANELA(1, 1));
+
+    ssd1306_pixel(&ssd, 3, 8, true);
+    ssd1306_pixel(&ssd, 9, 16, true);
+    conferir_envio("páginas vizinhas", JANELA(7, 2));
+    // Juntas, as duas páginas iriam numa janela de 128 colunas
+    ssd1306_pixel(&ssd, 0, 24, true);
+    ssd1306_pixel(&ssd, 127, 32, true);
+    conferir_envio("páginas vizinhas com colunas distantes", 2 * JANELA(1, 1));
+    // Três páginas em escada: a terceira sairia mais cara junto das outras
+    ssd1306_rect(&ssd, 8, 20, 10, 16, true, true);
+    ssd1306_rect(&ssd, 24, 100, 10, 8, true, true);
+    conferir_envio("escada de páginas", JANELA(10, 2) + JANELA(10, 1));
+
+    ssd1306_rect(&ssd, 48, 64, 16, 8, true, true);
+    conferir_envio("retângulo numa página", JANELA(16, 1));
+    ssd1306_rect(&ssd, 48, 64, 16, 8, true, true);
+    conferir_envio("mesmo retângulo de novo", 0);
+    // As colunas apagadas nas bordas dos glifos já estão iguais no painel
+    ssd1306_draw_string(&ssd, "OK", 64, 24);
+    conferir_envio("texto", JANELA(15, 1));
+    ssd1306_draw_string(&ssd, "OK", 64, 24);
+    conferir_envio("mesmo texto de novo", 0);
+
+    ssd1306_invalidate(&ssd);
+    conferir_envio("depois de invalidar", JANELA(WIDTH, SSD1306_MAX_PAGES));
+
+    // Transporte assíncrono: no host o quadro termina antes de retornar
+    ssd1306_i2c_dma_init(&ssd);
+    size_t antes = ssd1306_host_bus_bytes();
+    ssd1306_pixel(&ssd, 70, 10, true);
+    bool enviando = ssd1306_send_data_async(&ssd, quadro_enviado, NULL);
+    CONFERIR(enviando && quadros == 1, "assíncrono: enviando %d, %d quadros", enviando, quadros);
+    CONFERIR(ssd1306_host_bus_bytes() - antes == JANELA(1, 1), "assíncrono: %zu bytes",
+             ssd1306_host_bus_bytes() - antes);
+    enviando = ssd1306_send_data_async(&ssd, quadro_enviado, NULL);
+    CONFERIR(!enviando && quadros == 1, "assíncrono sem mudança: enviando %d, %d quadros", enviando, quadros);
+
+    ssd1306_transport_t hospedeiro = ssd.transport;
+
+    // Painel sem resposta: as duas janelas do quadro viram uma transação só,
+    // o quadro é dado como falho e o seguinte vai inteiro
+    ssd1306_transport_t sem_resposta = {escrever_nada, escrever_sem_resposta, preparar, abandonar, NULL};
+    ssd1306_set_transport(&ssd, &sem_resposta);
+    ssd1306_pixel(&ssd, 1, 1, true);
+    ssd1306_pixel(&ssd, 1, 60, true);
+    enviando = ssd1306_send_data_async(&ssd, quadro_enviado, NULL);
+    CONFERIR(enviando && !ssd.busy && quadros_falhos == 1 && transacoes == 1 && preparados == 1,
+             "sem resposta: busy %d, %d falhos, %d transações, %d preparos", ssd.busy, quadros_falhos, transacoes,
+             preparados);
+    ssd1306_set_transport(&ssd, &hospedeiro);
+    conferir_envio("depois de uma falha", JANELA(WIDTH, SSD1306_MAX_PAGES));
+
+    // Transação que não termina: abandonada, sem done, e o quadro seguinte inteiro
+    ssd1306_transport_t preso = {escrever_nada, escrever_preso, NULL, abandonar, NULL};
+    ssd1306_set_transport(&ssd, &preso);
+    ssd1306_pixel(&ssd, 2, 2, true);
+    enviando = ssd1306_send_data_async(&ssd, quadro_enviado, NULL);
+    CONFERIR(enviando && ssd.busy, "preso: enviando %d, busy %d", enviando, ssd.busy);
+    ssd1306_abort(&ssd);
+    CONFERIR(!ssd.busy && abandonos == 1 && quadros == 1 && quadros_falhos == 1,
+             "abandono: busy %d, %d abandonos, %d quadros, %d falhos", ssd.busy, abandonos, quadros, quadros_falhos);
+    ssd1306_set_transport(&ssd, &hospedeiro);
+    conferir_envio("depois de abandonar", JANELA(WIDTH, SSD1306_MAX_PAGES));
+
+    conferir_telas();
+
+    if (falhas)
+        printf("%d falhas\n", falhas);
+    else
+        printf("ssd1306: ok\n");
+    return falhas != 0;
+}
@@ -0,0 +1,119 @@
+#include "tela.h"
+#include <stdio.h>
+#include <string.h>
+
+// Testes da composição da tela (lib/tela.c): o buffer desenhado depois de uma
+// sequência de estados tem de ser igual ao de uma tela nova que recebe só o
+// último estado. Cobre a contagem que chega a 0 no meio da fase (plano
+// atuado), que não troca de cena nem de texto.
+
+#define QUADRO_BYTES (WIDTH * HEIGHT / 8)
+
+static int falhas;
+
+#define CONFERIR(cond, ...)                                      \
+    do {                                                         \
+        if (!(cond)) {                                           \
+            printf("FALHA %s:%d: ", __FILE__, __LINE__);         \
+            printf(__VA_ARGS__);                                 \
+            printf("\n");                                        \
+            falhas++;                                            \
+        }                                                        \
+    } while (0)
+
+typedef struct {
+    const char *nome;
+    bool noturno;
+    EstadoSemaforo fase;
+    bool sinal;
+} Caso;
+
+static const Caso casos[] = {
+    {"verde", false, ESTADO_VERDE, false},
+    {"amarelo", false, ESTADO_AMARELO, false},
+    {"vermelho", false, ESTADO_VERMELHO, false},
+    {"sinal verde", false, ESTADO_VERDE, true},
+    {"sinal amarelo", false, ESTADO_AMARELO, true},
+    {"sinal vermelho", false, ESTADO_VERMELHO, true},
+    {"noturno", true, ESTADO_AMARELO, false},
+};
+#define NUM_CASOS (sizeof(casos) / sizeof(casos[0]))
+
+// Um passo da sequência: a contagem mostrada e o instante
+typedef struct {
+    uint8_t contagem;
+    uint32_t agora;
+} Passo;
+
+static ssd1306_t ssd;
+
+static SemaforoEstado estado_do_caso(const Caso *c, uint8_t contagem) {
+    return (SemaforoEstado){.modo_noturno = c->noturno, .estado = c->fase, .exibindo_sinal = c->sinal,
+                            .contagem = contagem};
+}
+
+// Desenha os passos numa tela nova e guarda o buffer final
+static void desenhar(const Caso *c, const Passo *passos, int n, uint8_t *quadro, bool *mudou) {
+    Tela tela = {0};
+    ssd1306_fill(&ssd, true);
+    for (int i = 0; i < n; ++i) {
+        SemaforoEstado estado = estado_do_caso(c, passos[i].contagem);
+        *mudou = tela_atualizar(&tela, &ssd, &estado, passos[i].agora);
+    }
+    memcpy(quadro, ssd.ram_buffer + 1, QUADRO_BYTES);
+}
+
+static void conferir_sequencia(const char *nome, const Passo *passos, int n) {
+    static uint8_t obtido[QUADRO_BYTES], esperado[QUADRO_BYTES];
+    for (size_t i = 0; i < NUM_CASOS; ++i) {
+        bool mudou, ignorado;
+        desenhar(&casos[i], passos, n, obtido, &mudou);
+        desenhar(&casos[i], &passos[n - 1], 1, esperado, &ignorado);
+        CONFERIR(mudou, "%s, %s: a última mudança não pediu envio", casos[i].nome, nome);
+        CONFERIR(memcmp(obtido, esperado, QUADRO_BYTES) == 0, "%s, %s: tela diferente da desenhada do zero",
+                 casos[i].nome, nome);
+    }
+}
+
+// A tela desenhada do zero para o estado final, mas com o quadro da animação
+// em que a sequência terminou: a sequência é repetida sem a contagem
+static void conferir_animada(const char *nome, const Passo *passos, int n) {
+    static uint8_t obtido[QUADRO_BYTES], esperado[QUADRO_BYTES];
+    Passo sem_contagem[8];
+    for (int i = 0; i < n; ++i)
+        sem_contagem[i] = (Passo){0, passos[i].agora};
+    for (size_t i = 0; i < NUM_CASOS; ++i) {
+        bool mudou, ignorado;
+        desenhar(&casos[i], passos, n, obtido, &mudou);
+        desenhar(&casos[i], sem_contagem, n, esperado, &ignorado);
+        CONFERIR(mudou, "%s, %s: a última mudança não pediu envio", casos[i].nome, nome);
+        CONFERIR(memcmp(obtido, esperado, QUADRO_BYTES) == 0, "%s, %s: tela diferente da sem contagem",
+                 casos[i].nome, nome);
+    }
+}
+
+int main(void) {
+    ssd1306_init(&ssd, WIDTH, HEIGHT, false, 0x3C, NULL);
+
+    // Contagem que acaba sem troca de fase: o "1" não pode ficar na tela
+    static const Passo fim_da_contagem[] = {{1, 0}, {0, 0}};
+    conferir_sequencia("1 para 0", fim_da_contagem, 2);
+
+    static const Passo contagem_longa[] = {{12, 0}, {0, 0}};
+    conferir_sequencia("12 para 0", contagem_longa, 2);
+
+    // Contagem trocada no mesmo quadro da animação
+    static const Passo troca[] = {{3, 0}, {2, 0}};
+    conferir_sequencia("3 para 2", troca, 2);
+
+    // A contagem acaba depois de a animação avançar: volta o quadro atual,
+    // não o primeiro
+    static const Passo animada[] = {{3, 0}, {2, 600}, {1, 1200}, {0, 1210}};
+    conferir_animada("fim da contagem com animação", animada, 4);
+
+    if (falhas)
+        printf("%d falhas\n", falhas);
+    else
+        printf("tela: ok\n");
+    return falhas != 0;
+}
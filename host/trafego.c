@@ -0,0 +1,39 @@
+#include "trafego.h"
+#include "semaforo.h"
+#include <math.h>
+#include <string.h>
+
+int plano_por_nome(const char *nome) {
+    size_t n = strcspn(nome, "@");
+    for (int i = 0; i < NUM_PLANOS; ++i) {
+        const char *p = planos[i].nome;
+        if ((n == strlen(p) || n == strcspn(p, " ")) && strncmp(nome, p, n) == 0)
+            return i;
+    }
+    return -1;
+}
+
+uint64_t xorshift64(uint64_t *semente) {
+    *semente ^= *semente << 13;
+    *semente ^= *semente >> 7;
+    *semente ^= *semente << 17;
+    return *semente;
+}
+
+double aleatorio(uint64_t *semente) {
+    return (xorshift64(semente) >> 11) * (1.0 / 9007199254740992.0);
+}
+
+double tempo_chegada(uint64_t *semente, double taxa) {
+    return -log(1.0 - aleatorio(semente)) / taxa;
+}
+
+uint32_t intervalo_chegada(uint64_t *semente, double taxa) {
+    return (uint32_t)tempo_chegada(semente, taxa) + 1;
+}
+
+uint16_t sensor_fila(uint32_t fila) {
+    if (fila > FILA_SENSOR_CHEIO)
+        fila = FILA_SENSOR_CHEIO;
+    return fila * 4095 / FILA_SENSOR_CHEIO;
+}
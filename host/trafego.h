@@ -0,0 +1,38 @@
+#ifndef TRAFEGO_H
+#define TRAFEGO_H
+
+// Peças comuns dos modelos de tráfego em tempo virtual: host/simulador.c,
+// host/cidade.c, host/microsim.c e tools/onda_verde.c.
+
+#include <stdint.h>
+
+// No verde o primeiro carro da fila sai PERDA_PARTIDA ms depois da abertura e
+// os seguintes a cada INTERVALO_SAIDA ms
+#define INTERVALO_SAIDA 2000
+#define PERDA_PARTIDA 2000
+// Fila que leva o potenciômetro do sensor ao fim da escala
+#define FILA_SENSOR_CHEIO 10
+
+// Semente do xorshift64: a mesma sequência em toda execução, para comparar
+// planos. Não pode ser 0.
+#define SEMENTE_TRAFEGO 88172645463325252ull
+
+// Índice em planos[] pelo nome ("fora de pico") ou pela primeira palavra dele
+// ("fora"); o que vier depois de um '@' é ignorado. -1 se não houver.
+int plano_por_nome(const char *nome);
+
+// xorshift64 sobre a semente dada: cada modelo guarda a sua (o de cidade.c,
+// uma por cruzamento, para não depender da ordem de execução)
+uint64_t xorshift64(uint64_t *semente);
+// Uniforme em [0, 1)
+double aleatorio(uint64_t *semente);
+
+// Tempo até a próxima chegada de Poisson com a taxa dada (carros por ms), em
+// ms; intervalo_chegada arredonda para ms inteiros e nunca dá 0
+double tempo_chegada(uint64_t *semente, double taxa);
+uint32_t intervalo_chegada(uint64_t *semente, double taxa);
+
+// Leitura do ADC proporcional à fila, saturando em FILA_SENSOR_CHEIO carros
+uint16_t sensor_fila(uint32_t fila);
+
+#endif // TRAFEGO_H
@@ -1,114 +1,127 @@
-#include "pico/stdlib.h"
-#include "hardware/gpio.h"
-#include "hardware/pwm.h"
-#include "hardware/pio.h"
-#include "hardware/i2c.h"
+#include "lib/hal.h"
 #include "lib/ssd1306.h"
 #include "lib/font.h"
 #include "lib/bitmap.h"
+#include "lib/tela.h"
+#include "lib/semaforo.h"
+#include "lib/sincronia.h"
+#include "lib/matriz.h"
+#include "lib/digitos.h"
+#include "lib/energia.h"
 #include <stdio.h>
-#include <string.h>
-#include "ws2812.pio.h"
 #include "FreeRTOS.h"
 #include "task.h"
 
-#define NUM_PIXELS 25
 #define WS2812_PIN 7
+#define WS2812_FREQ 800000
 #define IS_RGBW false
 
-bool buffer_leds[NUM_PIXELS] = {false};
+// Painéis da matriz e o pino de cada cadeia. Cabeças maiores (por exemplo
+// vários 16x16) ganham uma entrada por painel; painéis em cadeias diferentes
+// são atualizados em paralelo.
+static const MatrizPainel paineis_matriz[] = {
+    {.cadeia = 0, .inicio = 0, .x = 0, .y = 0, .largura = 5, .altura = 5, .serpentina = false},
+};
+static const uint pinos_matriz[] = {WS2812_PIN};
 
-#define COR_WS2812_R 20
-#define COR_WS2812_G 20
-#define COR_WS2812_B 50
+Matriz matriz;
 
+#define BOTAO_A 5
+#define BOTAO_B 6
+
+// Pinos do cruzamento da placa: as três luzes (na ordem de Luz) e o buzzer.
+// Outra cabeça de semáforo seria outra tabela com outro Semaforo.
 #define LED_VERMELHO 13
 #define LED_AMARELO 12
 #define LED_VERDE 11
 #define BUZZER_PIN 10
-#define BOTAO_A 5
-#define BOTAO_B 6
 
-#define I2C_PORT i2c1
+typedef struct {
+    uint luzes[NUM_LUZES];
+    uint buzzer;
+} PinosSemaforo;
+
+static const PinosSemaforo pinos_semaforo = {{LED_VERMELHO, LED_AMARELO, LED_VERDE}, BUZZER_PIN};
+
+static void luz_gpio(void *ctx, uint id, Luz luz, bool acesa) {
+    const PinosSemaforo *pinos = ctx;
+    hal_gpio_put(pinos->luzes[luz], acesa);
+}
+
+static void buzzer_pwm(void *ctx, uint id, uint freq) {
+    const PinosSemaforo *pinos = ctx;
+    if (freq)
+        hal_pwm_tone_start(pinos->buzzer, freq);
+    else
+        hal_pwm_tone_stop(pinos->buzzer);
+}
+
+static uint16_t sensor_adc(void *ctx, uint id, uint canal) {
+    return hal_adc_media(canal);
+}
+
+Semaforo semaforo;
+
+// Os potenciômetros (GPIO 26 e 27) fazem o papel dos sensores de fila do
+// plano atuado; o DMA do ADC não acorda a CPU
+#define AMOSTRAS_ADC_POR_SEGUNDO 1000
+// A placa parte no ciclo fixo fora de pico. O plano atuado só faz sentido com
+// os potenciômetros ligados: -DPLANO_INICIAL=PLANO_ATUADO
+#ifndef PLANO_INICIAL
+#define PLANO_INICIAL PLANO_FORA_PICO
+#endif
+// Início de ciclo do plano coordenado no relógio da placa, calculado por
+// tools/onda_verde.c para a posição do cruzamento no corredor
+#ifndef DEFASAGEM_CRUZAMENTO
+#define DEFASAGEM_CRUZAMENTO 0
+#endif
+
+// Sincronia do corredor: a mestra gera um pulso por SINCRONIA_PERIODO do seu
+// relógio em PINO_SINCRONIA, ligado ao mesmo pino das escravas; com isso a
+// defasagem acima passa a valer no relógio da mestra em todas as placas
+#define SINCRONIA_DESLIGADA 0
+#define SINCRONIA_MESTRA 1
+#define SINCRONIA_ESCRAVA 2
+#ifndef PAPEL_SINCRONIA
+#define PAPEL_SINCRONIA SINCRONIA_DESLIGADA
+#endif
+#if PAPEL_SINCRONIA != SINCRONIA_DESLIGADA && PAPEL_SINCRONIA != SINCRONIA_MESTRA && \
+    PAPEL_SINCRONIA != SINCRONIA_ESCRAVA
+#error "PAPEL_SINCRONIA deve ser SINCRONIA_DESLIGADA, SINCRONIA_MESTRA ou SINCRONIA_ESCRAVA"
+#endif
+// Só o plano coordenado usa a defasagem: em outro plano o pulso seria gerado
+// ou seguido sem efeito nenhum. PLANO_* é enum, fora do alcance do #if.
+_Static_assert(PAPEL_SINCRONIA == SINCRONIA_DESLIGADA || PLANO_INICIAL == PLANO_COORDENADO,
+               "PAPEL_SINCRONIA exige -DPLANO_INICIAL=PLANO_COORDENADO");
+#define PINO_SINCRONIA 16
+#define LARGURA_PULSO_SINCRONIA_US 1000
+// Múltiplo do ciclo do plano coordenado
+#ifndef SINCRONIA_PERIODO
+#define SINCRONIA_PERIODO (COORDENADO_VERDE + COORDENADO_AMARELO + COORDENADO_VERMELHO)
+#endif
+
+static Sincronia sincronia;
+static volatile uint64_t borda_sincronia_us;
+
+#define I2C_PORT 1
 #define I2C_SDA 14
 #define I2C_SCL 15
 #define DISPLAY_ADDR 0x3C
 #define DISPLAY_WIDTH 128
 #define DISPLAY_HEIGHT 64
 
-typedef enum {
-    ESTADO_VERDE,
-    ESTADO_AMARELO,
-    ESTADO_VERMELHO
-} EstadoSemaforo;
-
-#define TEMPO_VERDE 5000
-#define TEMPO_AMARELO 2000
-#define TEMPO_VERMELHO 5000
-#define TEMPO_PISCA 1000
-#define TEMPO_BEEP_VERDE 100
-#define TEMPO_BEEP_AMARELO 100
-#define TEMPO_BEEP_VERMELHO 500
-#define TEMPO_OFF_AMARELO 100
-#define TEMPO_OFF_VERMELHO 1500
-#define TEMPO_ATUALIZACAO_DISPLAY 500
-#define TEMPO_BEEP_NOTURNO 2000
-#define DURACAO_BEEP_NOTURNO 100
-#define TEMPO_ANIMACAO 300
-#define TEMPO_ALTERNANCIA_NOTURNO 500
-#define TEMPO_EXIBICAO_SINAL 2000
-#define TEMPO_ALTERNANCIA_SINAL 250
 #define TEMPO_ANIMACAO_INICIAL 500
 
-volatile bool modo_noturno = false;
 volatile uint32_t last_button_time = 0;
 #define DEBOUNCE_TIME 300
-volatile bool noturno_alternado = false;
-volatile uint32_t tempo_ultimo_alternancia_noturno = 0;
-
-volatile EstadoSemaforo estado_semaforo = ESTADO_VERDE;
-volatile uint32_t tempo_ultimo_estado = 0;
-volatile uint32_t tempo_ultimo_beep = 0;
-volatile uint32_t tempo_ultimo_pisca = 0;
-volatile uint32_t tempo_ultimo_display = 0;
-volatile uint32_t tempo_ultimo_frame = 0;
-volatile uint32_t tempo_inicio_sinal = 0;
-volatile uint32_t tempo_ultimo_alternancia_sinal = 0;
-volatile bool estado_led_amarelo = false;
-volatile bool estado_buzzer = false;
-volatile bool exibindo_bitmap_sinal = false;
-volatile bool sinal_alternado = false;
-volatile uint8_t frame_atual = 0;
-#define NUM_FRAMES 3
 
 ssd1306_t display;
+Tela tela;
 volatile bool tela_inicial_concluida = false;
 
-void ws2812_set_color(uint8_t r, uint8_t g, uint8_t b) {
-    uint32_t color = ((uint32_t)(g) << 16) | ((uint32_t)(r) << 8) | b;
-    pio_sm_put_blocking(pio0, 0, color << 8u);
-}
-
-static inline uint32_t urgb_u32(uint8_t r, uint8_t g, uint8_t b) {
-    return ((uint32_t)r << 8) | ((uint32_t)g << 16) | (uint32_t)b;
-}
-
-static inline void enviar_pixel(uint32_t pixel_grb) {
-    pio_sm_put_blocking(pio0, 0, pixel_grb << 8u);
-}
-
-void definir_leds(uint8_t r, uint8_t g, uint8_t b) {
-    uint32_t cor = urgb_u32(r, g, b);
-    for (int i = 0; i < NUM_PIXELS; i++) {
-        if (buffer_leds[i])
-            enviar_pixel(cor);
-        else
-            enviar_pixel(0);
-    }
-    sleep_us(60);
-}
+#define PADRAO_LADO 5
 
-const bool padrao_semaforo[1][5][5] = {{
+const bool padrao_semaforo[1][PADRAO_LADO][PADRAO_LADO] = {{
     {false, false, false, false, false},
     {false, true, true, true, false},
     {false, true, true, true, false},
@@ -116,333 +129,391 @@ const bool padrao_semaforo[1][5][5] = {{
     {false, false, false, false, false}
 }};
 
-void atualizar_buffer_com_semaforo(int tipo) {
-    for (int linha = 0; linha < 5; linha++) {
-        for (int coluna = 0; coluna < 5; coluna++) {
-            int indice = linha * 5 + coluna;
-            buffer_leds[indice] = padrao_semaforo[tipo][linha][coluna];
+// Desenha o padrão centralizado na matriz com a cor dada; o resto fica apagado
+// e, numa matriz menor que o padrão, as bordas dele são cortadas
+void desenhar_padrao_semaforo(int tipo, uint32_t cor) {
+    int x = (MATRIZ_LARGURA - PADRAO_LADO) / 2;
+    int y = (MATRIZ_ALTURA - PADRAO_LADO) / 2;
+
+    matriz_preencher(&matriz, 0);
+    for (int linha = 0; linha < PADRAO_LADO; linha++) {
+        for (int coluna = 0; coluna < PADRAO_LADO; coluna++) {
+            if (padrao_semaforo[tipo][linha][coluna])
+                matriz_pixel(&matriz, x + coluna, y + linha, cor);
         }
     }
 }
 
-void atualizar_matriz_rgb_invertida(int estado_semaforo) {
-    uint8_t r = 0, g = 0, b = 0;
+static void desenhar_digito_matriz(uint digito, int x, int y, uint32_t cor) {
+    uint16_t mascara = digitos_matriz[digito];
+    for (int bit = DIGITO_MATRIZ_LARGURA * DIGITO_MATRIZ_ALTURA - 1, p = 0; bit >= 0; bit--, p++) {
+        if (mascara & (1u << bit))
+            matriz_pixel(&matriz, x + p % DIGITO_MATRIZ_LARGURA, y + p / DIGITO_MATRIZ_LARGURA, cor);
+    }
+}
+
+// Número centralizado na matriz com os dígitos 3x5. Se não couber (dois
+// dígitos na 5x5), fica só o primeiro dígito e, na última coluna, uma barra
+// com o resto, que esvazia até o dígito seguinte: 25 é "2" com a barra pela
+// metade, 20 é "2" sem barra
+void desenhar_contagem_matriz(uint valor, uint32_t cor) {
+    // escala: peso do primeiro dígito
+    int n = 1;
+    uint escala = 1;
+    while (valor / escala >= 10) {
+        escala *= 10;
+        n++;
+    }
+    int largura = n * (DIGITO_MATRIZ_LARGURA + 1) - 1;
+    int y = (MATRIZ_ALTURA - DIGITO_MATRIZ_ALTURA) / 2;
+
+    matriz_preencher(&matriz, 0);
+    if (largura <= MATRIZ_LARGURA) {
+        int x = (MATRIZ_LARGURA - largura) / 2;
+        for (uint peso = escala; peso; peso /= 10, x += DIGITO_MATRIZ_LARGURA + 1)
+            desenhar_digito_matriz(valor / peso % 10, x, y, cor);
+        return;
+    }
+
+    int x = (MATRIZ_LARGURA - DIGITO_MATRIZ_LARGURA - 2) / 2;
+    desenhar_digito_matriz(valor / escala, x < 0 ? 0 : x, y, cor);
+    uint barra = ((uint64_t)(valor % escala) * MATRIZ_ALTURA + escala - 1) / escala;
+    for (uint linha = 0; linha < barra; linha++)
+        matriz_pixel(&matriz, MATRIZ_LARGURA - 1, MATRIZ_ALTURA - 1 - linha, cor);
+}
+
+// Cores do ponto de vista do pedestre, o inverso das dos carros; o brilho é
+// aplicado na conversão, não nas cores
+#define COR_MATRIZ_VERMELHO matriz_rgb(255, 0, 0)
+#define COR_MATRIZ_AMARELO matriz_rgb(255, 255, 0)
+#define COR_MATRIZ_VERDE matriz_rgb(0, 255, 0)
 
-    if (!modo_noturno) {
-        switch (estado_semaforo) {
+// Intensidade máxima dos canais; à noite, metade
+#define BRILHO_MATRIZ 50
+#define BRILHO_MATRIZ_NOTURNO 25
+
+// Retorna false se o quadro anterior ainda estava sendo enviado
+bool atualizar_matriz_rgb_invertida(const SemaforoEstado *estado) {
+    uint32_t cor;
+
+    if (!estado->modo_noturno) {
+        switch (estado->estado) {
             case ESTADO_VERMELHO:
-                r = 0; g = 50; b = 0;
+                cor = COR_MATRIZ_VERDE;
                 break;
             case ESTADO_AMARELO:
-                r = 50; g = 50; b = 0;
+                cor = COR_MATRIZ_AMARELO;
                 break;
             case ESTADO_VERDE:
-                r = 50; g = 0; b = 0;
+            default:
+                cor = COR_MATRIZ_VERMELHO;
                 break;
         }
     } else {
-        r = 50; g = 50; b = 0;
+        cor = COR_MATRIZ_AMARELO;
     }
 
-    atualizar_buffer_com_semaforo(0);
-    for (int i = 0; i < NUM_PIXELS; i++) {
-        if (buffer_leds[i]) {
-            pio_sm_put_blocking(pio0, 0, urgb_u32(r, g, b) << 8u);
-        } else {
-            pio_sm_put_blocking(pio0, 0, 0);
-        }
+    matriz_brilho(&matriz, estado->modo_noturno ? BRILHO_MATRIZ_NOTURNO : BRILHO_MATRIZ);
+    if (estado->contagem) {
+        desenhar_contagem_matriz(estado->contagem, cor);
+    } else {
+        desenhar_padrao_semaforo(0, cor);
     }
-    sleep_us(60);
+    return matriz_mostrar(&matriz);
 }
 
+// Desenha um quadro 128x64 deslocado de (x_offset, y_offset); o que sai da tela é
+// cortado e o restante do buffer é preservado
 void ssd1306_display_bitmap_partial(ssd1306_t *ssd, const unsigned char *bitmap, int x_offset, int y_offset) {
-    ssd1306_fill(ssd, 0);
-    for (int i = 0; i < (DISPLAY_HEIGHT / 8) * DISPLAY_WIDTH; i++) {
-        ssd->ram_buffer[i + 1] = bitmap[i];
-    }
+    ssd1306_blit(ssd, bitmap, DISPLAY_WIDTH, DISPLAY_HEIGHT, x_offset, y_offset, SSD1306_ROP_REPLACE);
 }
 
-void adicionar_texto_informativo() {
-    char linha1[16], linha2[16], linha3[16], linha4[16];
-    memset(linha1, 0, sizeof(linha1));
-    memset(linha2, 0, sizeof(linha2));
-    memset(linha3, 0, sizeof(linha3));
-    memset(linha4, 0, sizeof(linha4));
+void init_display() {
+    i2c_inst_t *i2c = hal_i2c_init(I2C_PORT, 400 * 1000, I2C_SDA, I2C_SCL);
+    ssd1306_init(&display, DISPLAY_WIDTH, DISPLAY_HEIGHT, false, DISPLAY_ADDR, i2c);
+    ssd1306_config(&display);
+    ssd1306_i2c_dma_init(&display);
+}
 
-    int x_pos = 70, y_pos = 0, altura_linha = 10;
+#define EVENTO_BOTAO_A (1u << 0)
+#define EVENTO_QUADRO_ENVIADO (1u << 1)
+#define EVENTO_ACORDAR (1u << 2)
+#define EVENTO_ESTADO (1u << 3)
+#define EVENTO_SINCRONIA (1u << 4)
+
+#define CONTRASTE_NORMAL 0xFF
+#define CONTRASTE_NOTURNO 0x10
+
+// Núcleos do build SMP: o controle (e as interrupções dos botões, registradas
+// pela tarefa de inicialização) fica longe do I2C e do PIO das saídas
+#define NUCLEO_CONTROLE 0
+#define NUCLEO_SAIDAS 1
+
+// Pilha de cada tarefa, em palavras. Semáforo, display e inicialização chamam
+// printf com argumentos de 64 bits; o display também desenha o texto e os
+// quadros RLE. A folga medida de cada uma sai no relatório do display. Na
+// porta POSIX as tarefas são pthreads e ficam com a mínima de lá.
+#define PILHA(palavras) ((palavras) > configMINIMAL_STACK_SIZE ? (palavras) : configMINIMAL_STACK_SIZE)
+#define PILHA_SEMAFORO PILHA(512)
+#define PILHA_DISPLAY PILHA(512)
+#define PILHA_MATRIZ PILHA(256)
+#define PILHA_INICIAL PILHA(512)
+
+TaskHandle_t tarefa_semaforo;
+TaskHandle_t tarefa_display;
+TaskHandle_t tarefa_matriz;
+volatile uint32_t tempo_ultimo_toque = 0;
+
+// Intervalo dos relatórios de instrumentação pela serial
+#define TEMPO_RELATORIO 60000
+
+// Atraso com que a tarefa do semáforo acorda em relação ao prazo, para
+// comparar 1 núcleo e SMP
+
+typedef struct {
+    uint32_t max_us;
+    uint64_t soma_us;
+    uint32_t amostras;
+    uint32_t inicio;
+} Latencia;
+
+static Latencia latencia_semaforo;
+
+// Sono do tickless idle desde o relatório anterior
+static void relatar_energia(uint32_t intervalo_ms) {
+    static EnergiaContagem anterior;
+    EnergiaContagem atual = energia_contagem();
+    uint64_t dormindo_us = atual.dormindo_us - anterior.dormindo_us;
+    uint32_t sonos = atual.sonos - anterior.sonos;
+    printf("energia: dormindo %lu.%02lu%% do tempo (%lu sonos de %lu us em média; %llu us, %lu sonos desde o boot)\n",
+           (unsigned long)(dormindo_us / 10 / intervalo_ms), (unsigned long)(dormindo_us * 10 / intervalo_ms % 100),
+           (unsigned long)sonos, (unsigned long)(sonos ? dormindo_us / sonos : 0),
+           (unsigned long long)atual.dormindo_us, (unsigned long)atual.sonos);
+    anterior = atual;
+}
 
-    if (modo_noturno) {
-        strcpy(linha1, "NOTURNO AMARELO");
-        strcpy(linha2, "PISCANTE");
-        ssd1306_draw_string(&display, linha1, x_pos - 70, y_pos);
-        ssd1306_draw_string(&display, linha2, x_pos - 35, y_pos + altura_linha);
-    } else {
-        switch (estado_semaforo) {
-            case ESTADO_VERDE:
-                strcpy(linha1, "NORMAL"); strcpy(linha2, "VERDE"); strcpy(linha3, "(SIGA)");
-                break;
-            case ESTADO_AMARELO:
-                strcpy(linha1, "NORMAL"); strcpy(linha2, "AMARELO");
-                break;
-            case ESTADO_VERMELHO:
-                strcpy(linha1, "NORMAL"); strcpy(linha2, "VERMELHO");
-                break;
-        }
-        ssd1306_draw_string(&display, linha1, x_pos - 10, y_pos);
-        ssd1306_draw_string(&display, linha2, x_pos - 10, y_pos + altura_linha);
-        ssd1306_draw_string(&display, linha3, x_pos - 10, y_pos + 2 * altura_linha);
+static void registrar_latencia(Latencia *lat, uint64_t atraso_us, uint32_t agora) {
+    if (atraso_us > lat->max_us)
+        lat->max_us = atraso_us;
+    lat->soma_us += atraso_us;
+    lat->amostras++;
+
+    if (agora - lat->inicio >= TEMPO_RELATORIO) {
+        printf("[%s] atraso do semáforo: médio %lu us, máximo %lu us (%lu prazos)\n",
+               configNUM_CORES > 1 ? "SMP" : "1 núcleo",
+               (unsigned long)(lat->soma_us / lat->amostras), (unsigned long)lat->max_us,
+               (unsigned long)lat->amostras);
+        relatar_energia(agora - lat->inicio);
+        *lat = (Latencia){.inicio = agora};
     }
 }
 
-void iniciar_exibicao_sinal() {
-    exibindo_bitmap_sinal = true;
-    sinal_alternado = false;
-    tempo_inicio_sinal = to_ms_since_boot(get_absolute_time());
-    tempo_ultimo_alternancia_sinal = tempo_inicio_sinal;
+// Interrupção dos botões (borda de descida): filtra o repique, acende o
+// display e, no botão A, acorda a tarefa do semáforo, que é a única a alterar
+// o estado
+void botao_irq(uint gpio) {
+    static uint32_t ultimo_toque[2] = {0};
+    uint idx = (gpio == BOTAO_A) ? 0 : 1;
+    uint32_t agora = hal_millis();
+    if (agora - ultimo_toque[idx] <= DEBOUNCE_TIME)
+        return;
+    ultimo_toque[idx] = agora;
+    tempo_ultimo_toque = agora;
+
+    BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+    if (gpio == BOTAO_A) {
+        xTaskNotifyFromISR(tarefa_semaforo, EVENTO_BOTAO_A, eSetBits, &xHigherPriorityTaskWoken);
+    }
+    xTaskNotifyFromISR(tarefa_display, EVENTO_ACORDAR, eSetBits, &xHigherPriorityTaskWoken);
+    portYIELD_FROM_ISR(xHigherPriorityTaskWoken);
 }
 
-void atualizar_display() {
-    if (modo_noturno) {
-        if (to_ms_since_boot(get_absolute_time()) - tempo_ultimo_alternancia_noturno >= TEMPO_ALTERNANCIA_NOTURNO) {
-            noturno_alternado = !noturno_alternado;
-            tempo_ultimo_alternancia_noturno = to_ms_since_boot(get_absolute_time());
-        }
-        const unsigned char *bitmap_noturno = noturno_alternado ? epd_bitmap_noturnoTwo : epd_bitmap_noturnoOne;
-        ssd1306_display_bitmap_partial(&display, bitmap_noturno, 0, 0);
-    } else {
-        if (exibindo_bitmap_sinal) {
-            if (to_ms_since_boot(get_absolute_time()) - tempo_inicio_sinal >= TEMPO_EXIBICAO_SINAL) {
-                exibindo_bitmap_sinal = false;
-            } else {
-                if (to_ms_since_boot(get_absolute_time()) - tempo_ultimo_alternancia_sinal >= TEMPO_ALTERNANCIA_SINAL) {
-                    sinal_alternado = !sinal_alternado;
-                    tempo_ultimo_alternancia_sinal = to_ms_since_boot(get_absolute_time());
-                }
-                const unsigned char *bitmap_sinal = NULL;
-                if (estado_semaforo == ESTADO_VERDE) {
-                    bitmap_sinal = sinal_alternado ? epd_bitmap_sinalPass : epd_bitmap_sinal;
-                } else if (estado_semaforo == ESTADO_VERMELHO) {
-                    bitmap_sinal = sinal_alternado ? epd_bitmap_sinalSStop : epd_bitmap_sinal;
-                } else {
-                    bitmap_sinal = epd_bitmap_sinal;
-                }
-                ssd1306_display_bitmap_partial(&display, bitmap_sinal, 0, 0);
-            }
-        } else {
-            switch (estado_semaforo) {
-                case ESTADO_VERDE:
-                    if (to_ms_since_boot(get_absolute_time()) - tempo_ultimo_frame >= TEMPO_ANIMACAO) {
-                        frame_atual = (frame_atual + 1) % NUM_FRAMES;
-                        tempo_ultimo_frame = to_ms_since_boot(get_absolute_time());
-                    }
-                    switch (frame_atual) {
-                        case 0: ssd1306_display_bitmap_partial(&display, epd_bitmap_blindOne, 0, 0); break;
-                        case 1: ssd1306_display_bitmap_partial(&display, epd_bitmap_blindTwo, 0, 0); break;
-                        case 2: ssd1306_display_bitmap_partial(&display, epd_bitmap_blindThree, 0, 0); break;
-                    }
-                    break;
-                case ESTADO_AMARELO:
-                    ssd1306_display_bitmap_partial(&display, epd_bitmap_blindThree, 0, 0);
-                    break;
-                case ESTADO_VERMELHO:
-                    ssd1306_display_bitmap_partial(&display, epd_bitmap_blindOne, 0, 0);
-                    break;
-            }
-        }
-    }
-    adicionar_texto_informativo();
-    ssd1306_send_data(&display);
+// Borda do pulso da mestra: o instante é marcado aqui, antes de qualquer
+// fila, e a tarefa do semáforo faz as contas
+void sincronia_irq(uint gpio) {
+    borda_sincronia_us = hal_micros();
+    BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+    xTaskNotifyFromISR(tarefa_semaforo, EVENTO_SINCRONIA, eSetBits, &xHigherPriorityTaskWoken);
+    portYIELD_FROM_ISR(xHigherPriorityTaskWoken);
 }
 
-void iniciar_buzzer(uint freq) {
-    gpio_set_function(BUZZER_PIN, GPIO_FUNC_PWM);
-    uint slice_num = pwm_gpio_to_slice_num(BUZZER_PIN);
-    uint chan = pwm_gpio_to_channel(BUZZER_PIN);
-    uint32_t clock = 125000000;
-    uint32_t divider = 100;
-    uint32_t wrap = clock / (divider * freq);
-    pwm_set_clkdiv(slice_num, divider);
-    pwm_set_wrap(slice_num, wrap);
-    pwm_set_chan_level(slice_num, chan, wrap / 2);
-    pwm_set_enabled(slice_num, true);
-    estado_buzzer = true;
+// Acorda o display e a matriz assim que muda algo que aparece neles, em vez
+// de esperar o próximo quadro
+static void avisar_mudanca_visivel(void) {
+    static SemaforoEstado visto;
+    SemaforoEstado estado;
+    semaforo_ler(&semaforo, &estado);
+    if (estado.modo_noturno != visto.modo_noturno || estado.estado != visto.estado ||
+        estado.exibindo_sinal != visto.exibindo_sinal || estado.contagem != visto.contagem) {
+        // Com handle nulo o xTaskNotify para no configASSERT; uma tarefa que
+        // não pôde ser criada só fica sem aviso
+        if (tarefa_display)
+            xTaskNotify(tarefa_display, EVENTO_ESTADO, eSetBits);
+        if (tarefa_matriz)
+            xTaskNotifyGive(tarefa_matriz);
+        visto = estado;
+    }
 }
 
-void parar_buzzer() {
-    uint slice_num = pwm_gpio_to_slice_num(BUZZER_PIN);
-    pwm_set_enabled(slice_num, false);
-    gpio_set_function(BUZZER_PIN, GPIO_FUNC_SIO);
-    gpio_put(BUZZER_PIN, 0);
-    estado_buzzer = false;
+// Dorme até o próximo prazo da máquina de estados ou até um evento de botão
+void vTrafficLightTask(void *pvParameters) {
+    uint32_t espera = 0;
+    uint64_t previsto_us = 0;
+
+    while (1) {
+        uint32_t eventos = 0;
+        xTaskNotifyWait(0, UINT32_MAX, &eventos, pdMS_TO_TICKS(espera));
+
+        uint64_t agora_us = hal_micros();
+        uint32_t agora = (uint32_t)(agora_us / 1000);
+        if (!eventos && agora_us >= previsto_us) {
+            registrar_latencia(&latencia_semaforo, agora_us - previsto_us, agora);
+        }
+        if (eventos & EVENTO_BOTAO_A) {
+            semaforo_alternar_modo(&semaforo, agora);
+        }
+#if PAPEL_SINCRONIA != SINCRONIA_DESLIGADA
+        if (eventos & EVENTO_SINCRONIA) {
+            sincronia_pulso(&sincronia, borda_sincronia_us);
+        }
+        // Refeito a cada passo: acompanha a deriva e a volta dos 32 bits de agora
+        semaforo_coordenar(&semaforo, NULL, sincronia_defasagem_local(&sincronia, DEFASAGEM_CRUZAMENTO, agora_us));
+#endif
+        espera = semaforo_passo(&semaforo, agora);
+        avisar_mudanca_visivel();
+        // hal_millis e o tick do FreeRTOS não viram o ms juntos; nunca espera 0
+        if (espera == 0)
+            espera = 1;
+        previsto_us = (uint64_t)(agora_us / 1000 + espera) * 1000;
+    }
 }
 
-void init_display() {
-    i2c_init(I2C_PORT, 400 * 1000);
-    gpio_set_function(I2C_SDA, GPIO_FUNC_I2C);
-    gpio_set_function(I2C_SCL, GPIO_FUNC_I2C);
-    gpio_pull_up(I2C_SDA);
-    gpio_pull_up(I2C_SCL);
-    ssd1306_init(&display, DISPLAY_WIDTH, DISPLAY_HEIGHT, false, DISPLAY_ADDR, I2C_PORT);
-    ssd1306_config(&display);
+uint32_t quadros_desenhados = 0;
+uint32_t quadros_pulados = 0;
+volatile uint32_t quadros_falhos = 0;
+
+// Chamada na interrupção do I2C quando o quadro terminou de ser enviado ou
+// falhou (painel ausente ou sem resposta)
+void display_quadro_enviado(void *arg, bool ok) {
+    if (!ok)
+        quadros_falhos++;
+    BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+    xTaskNotifyFromISR((TaskHandle_t)arg, EVENTO_QUADRO_ENVIADO, eSetBits, &xHigherPriorityTaskWoken);
+    portYIELD_FROM_ISR(xHigherPriorityTaskWoken);
 }
 
-bool botao_pressionado(uint gpio) {
-    static uint32_t last_time[2] = {0};
-    uint idx = (gpio == BOTAO_A) ? 0 : 1;
-    
-    if (!gpio_get(gpio)) {
-        uint32_t now = to_ms_since_boot(get_absolute_time());
-        if (now - last_time[idx] > DEBOUNCE_TIME) {
-            last_time[idx] = now;
-            return true;
-        }
+// Eventos já recebidos pela tarefa do display e ainda não tratados
+static uint32_t eventos_display;
+
+// Espera qualquer um dos eventos (ou o timeout) e retorna os que chegaram
+static uint32_t esperar_evento_display(uint32_t eventos, TickType_t timeout) {
+    uint32_t novos = 0;
+    while (!(eventos_display & eventos) && xTaskNotifyWait(0, UINT32_MAX, &novos, timeout) == pdTRUE) {
+        eventos_display |= novos;
     }
-    return false;
+    uint32_t recebidos = eventos_display & eventos;
+    eventos_display &= ~eventos;
+    return recebidos;
 }
 
-void vButtonTask(void *pvParameters) {
-    while (1) {
-        if (botao_pressionado(BOTAO_A)) {
-            modo_noturno = !modo_noturno;
-            uint32_t now = to_ms_since_boot(get_absolute_time());
-            tempo_ultimo_estado = now;
-            tempo_ultimo_beep = now;
-            tempo_ultimo_pisca = now;
-            tempo_ultimo_alternancia_noturno = now;
-            noturno_alternado = false;
-            parar_buzzer();
-
-            if (modo_noturno) {
-                gpio_put(LED_VERMELHO, 0);
-                gpio_put(LED_VERDE, 0);
-                estado_led_amarelo = false;
-                exibindo_bitmap_sinal = false;
-            } else {
-                estado_semaforo = ESTADO_VERDE;
-                gpio_put(LED_VERMELHO, 0);
-                gpio_put(LED_AMARELO, 0);
-                gpio_put(LED_VERDE, 1);
-                frame_atual = 0;
-                iniciar_exibicao_sinal();
-            }
-        }
-        vTaskDelay(pdMS_TO_TICKS(10));
+// Um quadro inteiro leva ~25 ms a 400 kHz e o transporte desiste de cada
+// transação em 50 ms; isto só cobre um transporte que não respondeu
+#define TEMPO_MAXIMO_QUADRO 200
+
+// Espera o quadro em envio terminar; passado o limite o envio é abandonado e
+// o próximo quadro vai inteiro
+static void esperar_quadro_enviado(void) {
+    if (!esperar_evento_display(EVENTO_QUADRO_ENVIADO, pdMS_TO_TICKS(TEMPO_MAXIMO_QUADRO))) {
+        ssd1306_abort(&display);
+        quadros_falhos++;
+        // Um aviso que chegou junto com o abandono não vale para o próximo quadro
+        esperar_evento_display(EVENTO_QUADRO_ENVIADO, 0);
     }
 }
 
-void vTrafficLightTask(void *pvParameters) {
-    TickType_t xLastWakeTime = xTaskGetTickCount();
-    const TickType_t xFrequency = pdMS_TO_TICKS(10);
+void vDisplayTask(void *pvParameters) {
+    bool enviando = false;
+    bool noturno_aplicado = false;
+    uint32_t inicio_relatorio = hal_millis();
 
     while (1) {
-        uint32_t tempo_atual = to_ms_since_boot(get_absolute_time());
-
-        if (modo_noturno) {
-            if (tempo_atual - tempo_ultimo_pisca >= TEMPO_PISCA) {
-                estado_led_amarelo = !estado_led_amarelo;
-                gpio_put(LED_AMARELO, estado_led_amarelo);
-                tempo_ultimo_pisca = tempo_atual;
+        SemaforoEstado estado;
+        semaforo_ler(&semaforo, &estado);
+
+        // O quadro N+1 é desenhado enquanto o quadro N ainda está no barramento
+        if (tela_atualizar(&tela, &display, &estado, hal_millis())) {
+            quadros_desenhados++;
+            if (enviando) {
+                esperar_quadro_enviado();
             }
-
-            if (tempo_atual - tempo_ultimo_beep >= TEMPO_BEEP_NOTURNO) {
-                iniciar_buzzer(1500);
-                tempo_ultimo_beep = tempo_atual;
-            }
-
-            if (estado_buzzer && tempo_atual - tempo_ultimo_beep >= DURACAO_BEEP_NOTURNO) {
-                parar_buzzer();
+            if (estado.modo_noturno != noturno_aplicado) {
+                noturno_aplicado = estado.modo_noturno;
+                ssd1306_contrast(&display, noturno_aplicado ? CONTRASTE_NOTURNO : CONTRASTE_NORMAL);
             }
+            enviando = ssd1306_send_data_async(&display, display_quadro_enviado, xTaskGetCurrentTaskHandle());
         } else {
-            switch (estado_semaforo) {
-                case ESTADO_VERDE:
-                    if (!estado_buzzer && tempo_atual - tempo_ultimo_beep >= 1000) {
-                        iniciar_buzzer(2000);
-                        tempo_ultimo_beep = tempo_atual;
-                    }
-                    if (estado_buzzer && tempo_atual - tempo_ultimo_beep >= TEMPO_BEEP_VERDE) {
-                        parar_buzzer();
-                    }
-                    if (tempo_atual - tempo_ultimo_estado >= TEMPO_VERDE) {
-                        estado_semaforo = ESTADO_AMARELO;
-                        gpio_put(LED_VERDE, 0);
-                        gpio_put(LED_AMARELO, 1);
-                        tempo_ultimo_estado = tempo_atual;
-                    }
-                    break;
-
-                case ESTADO_AMARELO:
-                    if (tempo_atual - tempo_ultimo_beep >= (estado_buzzer ? TEMPO_BEEP_AMARELO : TEMPO_OFF_AMARELO)) {
-                        if (estado_buzzer) parar_buzzer();
-                        else iniciar_buzzer(3000);
-                        tempo_ultimo_beep = tempo_atual;
-                    }
-                    if (tempo_atual - tempo_ultimo_estado >= TEMPO_AMARELO) {
-                        estado_semaforo = ESTADO_VERMELHO;
-                        gpio_put(LED_AMARELO, 0);
-                        gpio_put(LED_VERMELHO, 1);
-                        tempo_ultimo_estado = tempo_atual;
-                        parar_buzzer();
-                        iniciar_exibicao_sinal();
-                    }
-                    break;
-
-                case ESTADO_VERMELHO:
-                    if (estado_buzzer) {
-                        if (tempo_atual - tempo_ultimo_beep >= TEMPO_BEEP_VERMELHO) {
-                            parar_buzzer();
-                            tempo_ultimo_beep = tempo_atual;
-                        }
-                    } else {
-                        if (tempo_atual - tempo_ultimo_beep >= TEMPO_OFF_VERMELHO) {
-                            iniciar_buzzer(1000);
-                            tempo_ultimo_beep = tempo_atual;
-                        }
-                    }
-                    if (tempo_atual - tempo_ultimo_estado >= TEMPO_VERMELHO) {
-                        estado_semaforo = ESTADO_VERDE;
-                        gpio_put(LED_VERMELHO, 0);
-                        gpio_put(LED_VERDE, 1);
-                        frame_atual = 0;
-                        tempo_ultimo_estado = tempo_atual;
-                        parar_buzzer();
-                        iniciar_exibicao_sinal();
-                    }
-                    break;
-            }
+            quadros_pulados++;
         }
-        vTaskDelayUntil(&xLastWakeTime, xFrequency);
-    }
-}
 
-void vDisplayTask(void *pvParameters) {
-    TickType_t xLastWakeTime = xTaskGetTickCount();
-    const TickType_t xFrequency = pdMS_TO_TICKS(TEMPO_ATUALIZACAO_DISPLAY);
+        uint32_t agora = hal_millis();
+        if (agora - inicio_relatorio >= TEMPO_RELATORIO) {
+            printf("display: %lu quadros desenhados, %lu pulados, %lu falhos\n",
+                   (unsigned long)quadros_desenhados, (unsigned long)quadros_pulados,
+                   (unsigned long)quadros_falhos);
+            printf("pilhas: folga mínima de %lu palavras no semáforo, %lu no display, %lu na matriz\n",
+                   (unsigned long)uxTaskGetStackHighWaterMark(tarefa_semaforo),
+                   (unsigned long)uxTaskGetStackHighWaterMark(NULL),
+                   (unsigned long)uxTaskGetStackHighWaterMark(tarefa_matriz));
+            inicio_relatorio = agora;
+        }
 
-    while (1) {
-        atualizar_display();
-        vTaskDelayUntil(&xLastWakeTime, xFrequency);
+        // No modo noturno sem toque nos botões o painel é desligado e a tarefa
+        // dorme até um botão; os toques anteriores são descartados antes do teste
+        esperar_evento_display(EVENTO_ACORDAR, 0);
+        if (estado.modo_noturno && agora - tempo_ultimo_toque >= TEMPO_DISPLAY_NOTURNO) {
+            if (enviando) {
+                esperar_quadro_enviado();
+                enviando = false;
+            }
+            ssd1306_power(&display, false);
+            esperar_evento_display(EVENTO_ACORDAR, portMAX_DELAY);
+            ssd1306_power(&display, true);
+            continue;
+        }
+
+        // Cenas animadas voltam no próximo quadro (no máximo um a cada
+        // TEMPO_ATUALIZACAO_DISPLAY); as estáticas só com aviso do semáforo
+        TickType_t timeout = portMAX_DELAY;
+        if (tela.animacao.seq->num_frames > 1) {
+            uint32_t periodo = tela.animacao.period_ms > TEMPO_ATUALIZACAO_DISPLAY ? tela.animacao.period_ms : TEMPO_ATUALIZACAO_DISPLAY;
+            uint32_t decorrido = agora - tela.animacao.last_ms;
+            timeout = pdMS_TO_TICKS(decorrido < periodo ? periodo - decorrido : 0);
+        }
+        esperar_evento_display(EVENTO_ESTADO | EVENTO_ACORDAR, timeout);
     }
 }
 
+// A matriz só muda com o modo ou a fase: dorme até o aviso do semáforo. Se o
+// quadro anterior ainda estava saindo, tenta de novo no tick seguinte.
 void vLEDMatrixTask(void *pvParameters) {
     while (1) {
-        atualizar_matriz_rgb_invertida(estado_semaforo);
-        vTaskDelay(pdMS_TO_TICKS(100));
+        SemaforoEstado estado;
+        semaforo_ler(&semaforo, &estado);
+        bool enviado = atualizar_matriz_rgb_invertida(&estado);
+        ulTaskNotifyTake(pdTRUE, enviado ? portMAX_DELAY : 1);
     }
 }
 
 void tela_inicial() {
-    gpio_init(BOTAO_B);
-    gpio_set_dir(BOTAO_B, GPIO_IN);
-    gpio_pull_up(BOTAO_B);
+    hal_gpio_init_input_pullup(BOTAO_B);
 
-    const unsigned char *bitmaps[] = {epd_bitmap_startOne, epd_bitmap_startTwo, epd_bitmap_startThree, epd_bitmap_startFour};
+    const unsigned char *bitmaps[] = {epd_rle_startOne, epd_rle_startTwo, epd_rle_startThree, epd_rle_startFour};
     for (int i = 0; i < 4; i++) {
-        ssd1306_display_bitmap_partial(&display, bitmaps[i], 0, 0);
+        ssd1306_draw_rle(&display, bitmaps[i]);
         ssd1306_send_data(&display);
-        uint32_t start = to_ms_since_boot(get_absolute_time());
-        while (to_ms_since_boot(get_absolute_time()) - start < TEMPO_ANIMACAO_INICIAL) {
-            if (!gpio_get(BOTAO_B) && (to_ms_since_boot(get_absolute_time()) - last_button_time > DEBOUNCE_TIME)) {
+        uint32_t start = hal_millis();
+        while (hal_millis() - start < TEMPO_ANIMACAO_INICIAL) {
+            if (!hal_gpio_get(BOTAO_B) && (hal_millis() - last_button_time > DEBOUNCE_TIME)) {
                 tela_inicial_concluida = true;
                 return;
             }
@@ -450,11 +521,11 @@ void tela_inicial() {
         }
     }
 
-    ssd1306_display_bitmap_partial(&display, epd_bitmap_startPress, 0, 0);
+    ssd1306_draw_rle(&display, epd_rle_startPress);
     ssd1306_send_data(&display);
 
     while (!tela_inicial_concluida) {
-        if (!gpio_get(BOTAO_B) && (to_ms_since_boot(get_absolute_time()) - last_button_time > DEBOUNCE_TIME)) {
+        if (!hal_gpio_get(BOTAO_B) && (hal_millis() - last_button_time > DEBOUNCE_TIME)) {
             tela_inicial_concluida = true;
         }
         vTaskDelay(pdMS_TO_TICKS(10));
@@ -464,44 +535,78 @@ void tela_inicial() {
     ssd1306_draw_string(&display, "IntelliTraffic", 10, 20);
     ssd1306_draw_string(&display, "Light", 45, 35);
     ssd1306_send_data(&display);
-    sleep_ms(2000);
+    hal_sleep_ms(2000);
 }
 
 void vStartupTask(void *pvParameters) {
     tela_inicial();
 
-    PIO pio = pio0;
-    uint sm = 0;
-    uint offset = pio_add_program(pio, &ws2812_program);
-    ws2812_program_init(pio, sm, offset, WS2812_PIN, 800000, IS_RGBW);
-
-    gpio_init(BOTAO_A);
-    gpio_set_dir(BOTAO_A, GPIO_IN);
-    gpio_pull_up(BOTAO_A);
+    for (uint c = 0; c < sizeof(pinos_matriz) / sizeof(pinos_matriz[0]); c++) {
+        hal_led_strip_init(c, pinos_matriz[c], WS2812_FREQ, IS_RGBW);
+    }
+    if (!matriz_init(&matriz, paineis_matriz, sizeof(paineis_matriz) / sizeof(paineis_matriz[0]), BRILHO_MATRIZ)) {
+        printf("matriz: painéis fora da área de desenho\n");
+    }
 
-    xTaskCreate(vTrafficLightTask, "Traffic", configMINIMAL_STACK_SIZE, NULL, 3, NULL);
-    xTaskCreate(vDisplayTask, "Display", configMINIMAL_STACK_SIZE, NULL, 2, NULL);
-    xTaskCreate(vButtonTask, "Button", configMINIMAL_STACK_SIZE, NULL, 2, NULL);
-    xTaskCreate(vLEDMatrixTask, "LEDMatrix", configMINIMAL_STACK_SIZE, NULL, 1, NULL);
+    hal_gpio_init_input_pullup(BOTAO_A);
+
+    hal_adc_init(AMOSTRAS_ADC_POR_SEGUNDO);
+    semaforo_selecionar_plano(&semaforo, PLANO_INICIAL);
+
+    // No SMP cada tarefa já nasce no seu núcleo: criada solta, ela poderia
+    // rodar no outro núcleo antes de ser fixada. As do display e da matriz
+    // são criadas antes da do semáforo, que as notifica assim que roda.
+#if configNUM_CORES > 1
+    xTaskCreateAffinitySet(vDisplayTask, "Display", PILHA_DISPLAY, NULL, 2, 1 << NUCLEO_SAIDAS,
+                           &tarefa_display);
+    xTaskCreateAffinitySet(vLEDMatrixTask, "LEDMatrix", PILHA_MATRIZ, NULL, 1, 1 << NUCLEO_SAIDAS,
+                           &tarefa_matriz);
+    xTaskCreateAffinitySet(vTrafficLightTask, "Traffic", PILHA_SEMAFORO, NULL, 3, 1 << NUCLEO_CONTROLE,
+                           &tarefa_semaforo);
+#else
+    xTaskCreate(vDisplayTask, "Display", PILHA_DISPLAY, NULL, 2, &tarefa_display);
+    xTaskCreate(vLEDMatrixTask, "LEDMatrix", PILHA_MATRIZ, NULL, 1, &tarefa_matriz);
+    xTaskCreate(vTrafficLightTask, "Traffic", PILHA_SEMAFORO, NULL, 3, &tarefa_semaforo);
+#endif
+    hal_gpio_irq_falling(BOTAO_A, botao_irq);
+    hal_gpio_irq_falling(BOTAO_B, botao_irq);
+#if PAPEL_SINCRONIA == SINCRONIA_MESTRA
+    hal_gpio_pulso_periodico(PINO_SINCRONIA, SINCRONIA_PERIODO, LARGURA_PULSO_SINCRONIA_US);
+#elif PAPEL_SINCRONIA == SINCRONIA_ESCRAVA
+    hal_gpio_init_input_pullup(PINO_SINCRONIA);
+    hal_gpio_irq_falling(PINO_SINCRONIA, sincronia_irq);
+#endif
 
     vTaskDelete(NULL);
 }
 
-int main() {
-    stdio_init_all();
-    gpio_init(LED_VERMELHO);
-    gpio_init(LED_AMARELO);
-    gpio_init(LED_VERDE);
-    gpio_set_dir(LED_VERMELHO, GPIO_OUT);
-    gpio_set_dir(LED_AMARELO, GPIO_OUT);
-    gpio_set_dir(LED_VERDE, GPIO_OUT);
+// Com configCHECK_FOR_STACK_OVERFLOW o kernel chama isto na troca de contexto
+// ao achar a pilha de uma tarefa estourada: a memória vizinha já pode estar
+// corrompida, então a placa para aqui
+void vApplicationStackOverflowHook(TaskHandle_t tarefa, char *nome) {
+    taskDISABLE_INTERRUPTS();
+    printf("pilha estourada na tarefa %s\n", nome);
+    while (1);
+}
 
-    gpio_init(BUZZER_PIN);
-    gpio_set_dir(BUZZER_PIN, GPIO_OUT);
+int main() {
+    hal_init();
+    for (int i = 0; i < NUM_LUZES; i++) {
+        hal_gpio_init_output(pinos_semaforo.luzes[i]);
+    }
+    hal_gpio_init_output(pinos_semaforo.buzzer);
+    SaidasSemaforo saidas = {luz_gpio, buzzer_pwm, sensor_adc, (void *)&pinos_semaforo};
+    semaforo_init(&semaforo, &saidas, 0);
+    semaforo_coordenar(&semaforo, NULL, DEFASAGEM_CRUZAMENTO);
+    sincronia_init(&sincronia, SINCRONIA_PERIODO);
 
     init_display();
 
-    xTaskCreate(vStartupTask, "Startup", configMINIMAL_STACK_SIZE, NULL, 4, NULL);
+#if configNUM_CORES > 1
+    xTaskCreateAffinitySet(vStartupTask, "Startup", PILHA_INICIAL, NULL, 4, 1 << NUCLEO_CONTROLE, NULL);
+#else
+    xTaskCreate(vStartupTask, "Startup", PILHA_INICIAL, NULL, 4, NULL);
+#endif
     vTaskStartScheduler();
 
     while (1);
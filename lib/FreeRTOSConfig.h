@@ -42,7 +42,7 @@
  
  /* Scheduler Related */
  #define configUSE_PREEMPTION                    1
- #define configUSE_TICKLESS_IDLE                 0
+ #define configUSE_TICKLESS_IDLE                 1
  #define configUSE_IDLE_HOOK                     0
  #define configUSE_TICK_HOOK                     0
  #define configTICK_RATE_HZ                      ( ( TickType_t ) 1000 )
@@ -75,7 +75,10 @@
  #define configAPPLICATION_ALLOCATED_HEAP        0
  
  /* Hook function related definitions. */
- #define configCHECK_FOR_STACK_OVERFLOW          0
+ /* Confere a pilha de cada tarefa na troca de contexto (o fim da pilha deve
+  * continuar com o padrão de preenchimento); estouro vai para
+  * vApplicationStackOverflowHook em intellitraffic.c */
+ #define configCHECK_FOR_STACK_OVERFLOW          2
  #define configUSE_MALLOC_FAILED_HOOK            0
  #define configUSE_DAEMON_TASK_STARTUP_HOOK      0
  
@@ -102,7 +105,16 @@
  */
  
  /* SMP port only */
+ /* INTELLITRAFFIC_SMP (opção do CMake): controle no núcleo 0, display e matriz
+  * no núcleo 1. O port SMP do RP2040 não tem tickless idle. */
+ #ifdef INTELLITRAFFIC_SMP
+ #define configNUM_CORES                         2
+ #define configUSE_CORE_AFFINITY                 1
+ #undef configUSE_TICKLESS_IDLE
+ #define configUSE_TICKLESS_IDLE                 0
+ #else
  #define configNUM_CORES                         1
+ #endif
  #define configTICK_CORE                         1
  #define configRUN_MULTIPLE_PRIORITIES           1
  
@@ -133,6 +145,14 @@
  #define INCLUDE_xTaskResumeFromISR              1
  #define INCLUDE_xQueueGetMutexHolder            1
  
+ /* Tickless idle: o sono entre prazos fica em energia.c */
+ #if configUSE_TICKLESS_IDLE
+ #ifndef __ASSEMBLER__
+ void energia_dormir( uint32_t ticks_esperados );
+ #endif
+ #define portSUPPRESS_TICKS_AND_SLEEP( xExpectedIdleTime )  energia_dormir( xExpectedIdleTime )
+ #endif
+
  /* A header file that defines trace macro can be included here. */
  
  #endif /* FREERTOS_CONFIG_H */
\ No newline at end of file
@@ -0,0 +1,32 @@
+#include "animation.h"
+
+// Desenha o primeiro quadro da sequência e reinicia a contagem de tempo
+void animation_start(animation_t *anim, ssd1306_t *ssd, const bitmap_sequence_t *seq, uint16_t period_ms, uint32_t now) {
+  anim->seq = seq;
+  anim->frame = 0;
+  anim->period_ms = period_ms;
+  anim->last_ms = now;
+  ssd1306_draw_rle(ssd, seq->base);
+}
+
+// Avança no máximo um quadro se já passou o período desde a última troca.
+// Retorna true se o buffer foi alterado.
+bool animation_update(animation_t *anim, ssd1306_t *ssd, uint32_t now) {
+  if (anim->seq->num_frames < 2 || now - anim->last_ms < anim->period_ms)
+    return false;
+  ssd1306_apply_delta(ssd, anim->seq->deltas[anim->frame]);
+  anim->frame = (anim->frame + 1) % anim->seq->num_frames;
+  anim->last_ms = now;
+  return true;
+}
+
+// Redesenha o quadro atual inteiro (base e deltas até ele) sem mexer no tempo
+void animation_redraw(animation_t *anim, ssd1306_t *ssd) {
+  ssd1306_draw_rle(ssd, anim->seq->base);
+  for (uint8_t i = 0; i < anim->frame; ++i)
+    ssd1306_apply_delta(ssd, anim->seq->deltas[i]);
+}
+
+void animation_set_period(animation_t *anim, uint16_t period_ms) {
+  anim->period_ms = period_ms;
+}
@@ -0,0 +1,22 @@
+#ifndef ANIMATION_H
+#define ANIMATION_H
+
+#include "ssd1306.h"
+#include "bitmap.h"
+
+// Reprodução de uma bitmap_sequence_t no display: o primeiro quadro é
+// descompactado inteiro e os seguintes são obtidos aplicando os deltas, de
+// modo que só os trechos alterados são escritos (e enviados pelo I2C).
+typedef struct {
+  const bitmap_sequence_t *seq;
+  uint8_t frame;
+  uint16_t period_ms;
+  uint32_t last_ms;
+} animation_t;
+
+void animation_start(animation_t *anim, ssd1306_t *ssd, const bitmap_sequence_t *seq, uint16_t period_ms, uint32_t now);
+bool animation_update(animation_t *anim, ssd1306_t *ssd, uint32_t now);
+void animation_redraw(animation_t *anim, ssd1306_t *ssd);
+void animation_set_period(animation_t *anim, uint16_t period_ms);
+
+#endif // ANIMATION_H
@@ -18,6 +18,37 @@ extern const unsigned char	epd_bitmap_startTwo[];
 extern const int epd_bitmap_allArray_LEN;
 extern const unsigned char* epd_bitmap_allArray[];
 
+// Versões compactadas (RLE) usadas pelo firmware, geradas por tools/bitmap_rle.c
+extern const unsigned char epd_rle_blindOne[];
+extern const unsigned char epd_rle_blindTwo[];
+extern const unsigned char epd_rle_blindThree[];
+extern const unsigned char epd_rle_sinal[];
+extern const unsigned char epd_rle_sinalPass[];
+extern const unsigned char epd_rle_sinalSStop[];
+extern const unsigned char epd_rle_noturnoOne[];
+extern const unsigned char epd_rle_noturnoTwo[];
+extern const unsigned char epd_rle_startFour[];
+extern const unsigned char epd_rle_startOne[];
+extern const unsigned char epd_rle_startPress[];
+extern const unsigned char epd_rle_startThree[];
+extern const unsigned char epd_rle_startTwo[];
+
+// Sequência de animação: primeiro quadro em RLE e deltas entre quadros
+// consecutivos; deltas[i] leva o quadro i ao quadro (i + 1) % num_frames
+typedef struct {
+    const unsigned char *base;
+    const unsigned char *const *deltas;
+    unsigned char num_frames;
+} bitmap_sequence_t;
+
+extern const bitmap_sequence_t epd_seq_blind;          // blindOne, blindTwo, blindThree
+extern const bitmap_sequence_t epd_seq_sinalVerde;     // sinal, sinalPass
+extern const bitmap_sequence_t epd_seq_sinalVermelho;  // sinal, sinalSStop
+extern const bitmap_sequence_t epd_seq_noturno;        // noturnoOne, noturnoTwo
+extern const bitmap_sequence_t epd_seq_sinal;          // quadros estáticos
+extern const bitmap_sequence_t epd_seq_blindOne;
+extern const bitmap_sequence_t epd_seq_blindThree;
+
 #endif // BITMAP_H
 
 
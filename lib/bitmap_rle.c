@@ -0,0 +1,420 @@
+// Gerado por tools/bitmap_rle.c a partir de lib/bitmap.c. Não editar.
+
+#include <stddef.h>
+#include "bitmap.h"
+
+// 'blindOne', 64x128px, 287 bytes (RLE)
+const unsigned char epd_rle_blindOne [] = {
+	0xb9, 0x02, 0xc0, 0xff, 0xff, 0x82, 0x04, 0x80, 0xff, 0xcf, 0x03, 0xe0, 0x82, 0x05, 0xc0, 0x0f,
+	0xf8, 0x00, 0xc0, 0x07, 0x81, 0x7f, 0xc0, 0x03, 0x70, 0x00, 0x80, 0x1f, 0x80, 0x0f, 0xc0, 0x01,
+	0x40, 0x00, 0x80, 0xff, 0xff, 0x08, 0xc0, 0x10, 0x40, 0x00, 0x80, 0x00, 0x7f, 0x08, 0xc0, 0x10,
+	0x40, 0xfe, 0x80, 0x00, 0x20, 0x08, 0xc0, 0x10, 0x40, 0x83, 0x80, 0x38, 0x20, 0x08, 0xc0, 0x10,
+	0x40, 0x81, 0xff, 0x3f, 0x20, 0x0c, 0x40, 0x30, 0x40, 0x81, 0x00, 0x3c, 0x20, 0x0c, 0x40, 0x30,
+	0x40, 0x81, 0x00, 0x3c, 0x20, 0x08, 0x40, 0x30, 0x40, 0x83, 0xff, 0x3f, 0x20, 0x08, 0x40, 0x30,
+	0x40, 0xfe, 0x80, 0x00, 0xff, 0x09, 0x40, 0x30, 0x40, 0x00, 0x80, 0xff, 0xff, 0x09, 0x40, 0x30,
+	0x40, 0x00, 0x80, 0x07, 0xc0, 0x08, 0x40, 0xf8, 0x41, 0x00, 0x80, 0x01, 0xc0, 0x08, 0xc0, 0xe8,
+	0xe1, 0x00, 0x80, 0x00, 0x80, 0x08, 0xc0, 0x0f, 0xff, 0x01, 0xe0, 0x00, 0x80, 0x08, 0x00, 0xf8,
+	0xc1, 0xff, 0xff, 0x00, 0x80, 0x0c, 0x82, 0x04, 0x02, 0x01, 0x00, 0x80, 0x07, 0x82, 0x01, 0x06,
+	0x03, 0x85, 0x01, 0x04, 0x02, 0x85, 0x01, 0x8c, 0x03, 0x85, 0x01, 0xe8, 0x01, 0x85, 0x01, 0x38,
+	0x03, 0x85, 0x01, 0x66, 0x02, 0x85, 0x01, 0x4c, 0x06, 0x85, 0x01, 0x58, 0x06, 0x85, 0x01, 0xf0,
+	0x07, 0x85, 0x01, 0xf0, 0x07, 0x85, 0x01, 0xe0, 0x03, 0x85, 0x01, 0x80, 0x01, 0x86, 0x00, 0x03,
+	0x86, 0x00, 0x06, 0x86, 0x00, 0x1c, 0x86, 0x00, 0x18, 0x86, 0x00, 0x30, 0x86, 0x00, 0x60, 0x86,
+	0x00, 0x80, 0x87, 0x00, 0x01, 0x86, 0x00, 0x02, 0x86, 0x00, 0x02, 0x86, 0x00, 0x04, 0x86, 0x00,
+	0x08, 0x86, 0x00, 0x10, 0x86, 0x00, 0x20, 0x86, 0x00, 0x40, 0x86, 0x00, 0x80, 0x87, 0x00, 0x01,
+	0x86, 0x00, 0x02, 0x86, 0x00, 0x04, 0x86, 0x00, 0x08, 0x86, 0x00, 0x08, 0x86, 0x00, 0x10, 0x86,
+	0x00, 0x20, 0x86, 0x00, 0x40, 0x86, 0x00, 0x80, 0x87, 0x00, 0x01, 0xff, 0xff, 0xff, 0xf7
+};
+
+// 'blindTwo', 64x128px, 279 bytes (RLE)
+const unsigned char epd_rle_blindTwo [] = {
+	0xb9, 0x02, 0xc0, 0xff, 0xff, 0x82, 0x04, 0x80, 0xff, 0xcf, 0x03, 0xe0, 0x82, 0x05, 0xc0, 0x0f,
+	0xf8, 0x00, 0xc0, 0x07, 0x81, 0x7f, 0xc0, 0x03, 0x70, 0x00, 0x80, 0x1f, 0x80, 0x0f, 0xc0, 0x01,
+	0x40, 0x00, 0x80, 0xff, 0xff, 0x08, 0xc0, 0x10, 0x40, 0x00, 0x80, 0x00, 0x7f, 0x08, 0xc0, 0x10,
+	0x40, 0xfe, 0x80, 0x00, 0x20, 0x08, 0xc0, 0x10, 0x40, 0x83, 0x80, 0x38, 0x20, 0x08, 0xc0, 0x10,
+	0x40, 0x81, 0xff, 0x3f, 0x20, 0x0c, 0x40, 0x30, 0x40, 0x81, 0x00, 0x3c, 0x20, 0x0c, 0x40, 0x30,
+	0x40, 0x81, 0x00, 0x3c, 0x20, 0x08, 0x40, 0x30, 0x40, 0x83, 0xff, 0x3f, 0x20, 0x08, 0x40, 0x30,
+	0x5c, 0xfe, 0x80, 0x00, 0xff, 0x09, 0x40, 0x30, 0x58, 0x00, 0x80, 0xff, 0xff, 0x09, 0x40, 0x30,
+	0x58, 0x00, 0x80, 0x07, 0xe0, 0x08, 0x40, 0xf8, 0x51, 0x00, 0x80, 0x07, 0xf0, 0x08, 0xc0, 0xe8,
+	0xf1, 0x00, 0x80, 0x38, 0x90, 0x08, 0xc0, 0x0f, 0xff, 0x01, 0xe0, 0xe0, 0x98, 0x08, 0x00, 0xf8,
+	0xc1, 0xff, 0xff, 0x80, 0x9f, 0x0c, 0x82, 0x04, 0x02, 0x01, 0x00, 0x8c, 0x07, 0x82, 0x04, 0x06,
+	0x03, 0x00, 0x08, 0x04, 0x82, 0x04, 0x04, 0x02, 0x00, 0x08, 0x02, 0x82, 0x04, 0x8c, 0x03, 0x00,
+	0x08, 0x01, 0x82, 0x04, 0xe8, 0x01, 0x00, 0x08, 0x02, 0x82, 0x04, 0x38, 0x03, 0x00, 0x04, 0x03,
+	0x82, 0x04, 0x60, 0x02, 0x00, 0x04, 0x01, 0x82, 0x04, 0x44, 0x06, 0x00, 0x0c, 0x01, 0x82, 0x04,
+	0x58, 0x06, 0x00, 0x98, 0x01, 0x82, 0x03, 0xf0, 0x07, 0x00, 0xf0, 0x83, 0x01, 0xf0, 0x07, 0x85,
+	0x01, 0xe0, 0x03, 0x85, 0x01, 0x80, 0x07, 0x86, 0x00, 0x18, 0x86, 0x00, 0x20, 0x86, 0x00, 0xc0,
+	0x87, 0x00, 0x03, 0x86, 0x00, 0x04, 0x86, 0x00, 0x18, 0x86, 0x00, 0x60, 0x86, 0x00, 0x80, 0x87,
+	0x00, 0x03, 0x86, 0x00, 0x0c, 0x86, 0x00, 0x10, 0x86, 0x00, 0x60, 0x86, 0x01, 0x80, 0x01, 0x86,
+	0x00, 0x02, 0xff, 0xff, 0xff, 0xff, 0xd7
+};
+
+// 'blindThree', 64x128px, 287 bytes (RLE)
+const unsigned char epd_rle_blindThree [] = {
+	0xb9, 0x02, 0xc0, 0xff, 0xff, 0x82, 0x04, 0x80, 0xff, 0xcf, 0x03, 0xe0, 0x82, 0x05, 0xc0, 0x0f,
+	0xf8, 0x00, 0xc0, 0x07, 0x81, 0x7f, 0xc0, 0x03, 0x70, 0x00, 0x80, 0x1f, 0x80, 0x0f, 0xc0, 0x01,
+	0x40, 0x00, 0x80, 0xff, 0xff, 0x08, 0xc0, 0x10, 0x40, 0x00, 0x80, 0x00, 0x7f, 0x08, 0xc0, 0x10,
+	0x40, 0xfe, 0x80, 0x00, 0x20, 0x08, 0xc0, 0x10, 0x40, 0x83, 0x80, 0x38, 0x20, 0x08, 0xc0, 0x10,
+	0x40, 0x81, 0xff, 0x3f, 0x20, 0x0c, 0x40, 0x30, 0x40, 0x81, 0x00, 0x3c, 0x20, 0x0c, 0x40, 0x30,
+	0x40, 0x81, 0x00, 0x3c, 0x20, 0x08, 0x40, 0x30, 0x40, 0x83, 0xff, 0x3f, 0x20, 0x08, 0x40, 0x30,
+	0x5c, 0xfe, 0x80, 0x00, 0xff, 0x09, 0x40, 0x30, 0x58, 0x00, 0x80, 0xff, 0xff, 0x09, 0x40, 0x30,
+	0x58, 0x00, 0x80, 0x07, 0xc0, 0x08, 0x40, 0xf8, 0x51, 0x00, 0x80, 0x01, 0xc0, 0x08, 0xc0, 0xe8,
+	0xf1, 0x00, 0x80, 0x00, 0x80, 0x08, 0xc0, 0x0f, 0xff, 0x01, 0xe0, 0x00, 0x80, 0x08, 0x00, 0xf8,
+	0xc1, 0xff, 0xff, 0x00, 0x80, 0x0c, 0x82, 0x04, 0x02, 0x01, 0x00, 0x80, 0x07, 0x82, 0x01, 0x06,
+	0x03, 0x85, 0x01, 0x04, 0x02, 0x85, 0x01, 0x8c, 0x03, 0x85, 0x01, 0xe8, 0x01, 0x85, 0x01, 0x38,
+	0x03, 0x85, 0x01, 0x66, 0x02, 0x85, 0x01, 0x4c, 0x06, 0x85, 0x01, 0x58, 0x06, 0x85, 0x01, 0xf0,
+	0x07, 0x85, 0x01, 0xf0, 0x07, 0x85, 0x01, 0xe0, 0x03, 0x85, 0x01, 0x80, 0x01, 0x86, 0x00, 0x03,
+	0x86, 0x00, 0x06, 0x86, 0x00, 0x1c, 0x86, 0x00, 0x18, 0x86, 0x00, 0x30, 0x86, 0x00, 0x60, 0x86,
+	0x00, 0x80, 0x87, 0x00, 0x01, 0x86, 0x00, 0x02, 0x86, 0x00, 0x02, 0x86, 0x00, 0x04, 0x86, 0x00,
+	0x08, 0x86, 0x00, 0x10, 0x86, 0x00, 0x20, 0x86, 0x00, 0x40, 0x86, 0x00, 0x80, 0x87, 0x00, 0x01,
+	0x86, 0x00, 0x02, 0x86, 0x00, 0x04, 0x86, 0x00, 0x08, 0x86, 0x00, 0x08, 0x86, 0x00, 0x10, 0x86,
+	0x00, 0x20, 0x86, 0x00, 0x40, 0x86, 0x00, 0x80, 0x87, 0x00, 0x01, 0xff, 0xff, 0xff, 0xf7
+};
+
+// 'sinal', 64x128px, 265 bytes (RLE)
+const unsigned char epd_rle_sinal [] = {
+	0xef, 0x0b, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xfc, 0x03, 0x00, 0x20, 0x81, 0x02,
+	0xc0, 0x0f, 0x7c, 0x81, 0x00, 0x20, 0x82, 0x01, 0x0f, 0x1c, 0x81, 0x00, 0x20, 0x82, 0x01, 0x0e,
+	0x1c, 0x81, 0x00, 0x20, 0x82, 0x01, 0x0e, 0x0c, 0x81, 0x00, 0x20, 0x82, 0x01, 0x08, 0x0c, 0x81,
+	0x00, 0x20, 0x82, 0x01, 0x08, 0x0c, 0x81, 0x00, 0x20, 0x82, 0x01, 0x09, 0x04, 0x81, 0x00, 0x20,
+	0x81, 0x02, 0x80, 0x08, 0x04, 0x81, 0x00, 0x20, 0x81, 0x02, 0x40, 0x08, 0x04, 0x81, 0x65, 0x20,
+	0x00, 0x06, 0x30, 0x08, 0x04, 0x00, 0x04, 0x28, 0x00, 0x3a, 0x08, 0x08, 0x04, 0x00, 0x02, 0x26,
+	0x00, 0x01, 0x06, 0x08, 0xc4, 0x01, 0x01, 0x21, 0x0e, 0xc1, 0x01, 0x08, 0xe4, 0x83, 0x80, 0x20,
+	0x9f, 0xfc, 0x01, 0x08, 0xf4, 0x47, 0x60, 0xa0, 0xbf, 0x7f, 0x01, 0x08, 0xf4, 0xff, 0x1f, 0xa0,
+	0xff, 0x07, 0x02, 0x08, 0xf4, 0xff, 0x1f, 0xa0, 0xff, 0x02, 0x02, 0x08, 0xf4, 0x47, 0x60, 0xa0,
+	0x3f, 0x0c, 0x04, 0x08, 0xe4, 0x83, 0x80, 0x20, 0x1f, 0x10, 0x38, 0x08, 0xc4, 0x01, 0x01, 0x21,
+	0x0e, 0x08, 0xc0, 0x09, 0x04, 0x00, 0x02, 0x26, 0x00, 0x08, 0x00, 0x08, 0x04, 0x00, 0x04, 0x28,
+	0x00, 0x04, 0x00, 0x08, 0x04, 0x81, 0x00, 0x20, 0x82, 0x01, 0x08, 0x04, 0x81, 0x00, 0x20, 0x82,
+	0x01, 0x08, 0x04, 0x81, 0x00, 0x20, 0x82, 0x01, 0x08, 0x04, 0x81, 0x00, 0x20, 0x82, 0x01, 0x08,
+	0x0c, 0x81, 0x00, 0x20, 0x82, 0x01, 0x08, 0x0c, 0x81, 0x00, 0x20, 0x82, 0x01, 0x08, 0x0c, 0x81,
+	0x00, 0x20, 0x82, 0x01, 0x0e, 0x0c, 0x81, 0x00, 0x20, 0x82, 0x01, 0x0e, 0x3c, 0x81, 0x00, 0x20,
+	0x81, 0x05, 0x80, 0x0f, 0xfc, 0x01, 0x00, 0x20, 0x81, 0x09, 0xc0, 0x0f, 0xfc, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff
+};
+
+// 'sinalPass', 64x128px, 435 bytes (RLE)
+const unsigned char epd_rle_sinalPass [] = {
+	0x86, 0x00, 0x0c, 0x82, 0x00, 0x30, 0x82, 0x00, 0x0c, 0x82, 0x04, 0x30, 0x00, 0x0c, 0x00, 0x0e,
+	0x82, 0x04, 0x70, 0x00, 0x0c, 0x00, 0x06, 0x82, 0x04, 0x60, 0x00, 0x0c, 0x00, 0x07, 0x82, 0x04,
+	0xe0, 0x00, 0x0c, 0x00, 0x03, 0x82, 0x04, 0xc0, 0x00, 0x0c, 0x80, 0x03, 0x82, 0x04, 0xc0, 0x00,
+	0x0c, 0x80, 0x01, 0x82, 0x04, 0xc0, 0x01, 0x0c, 0x80, 0x01, 0x82, 0x04, 0x80, 0x01, 0x0c, 0xc0,
+	0x01, 0x82, 0x03, 0x80, 0x03, 0x0c, 0xc0, 0x84, 0x02, 0x03, 0x0c, 0xe0, 0x84, 0x02, 0x03, 0x0c,
+	0x60, 0x84, 0x14, 0x07, 0x0c, 0x70, 0x00, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xfc,
+	0x03, 0x00, 0x20, 0x0e, 0x0c, 0xf8, 0x0f, 0x7c, 0x81, 0x05, 0x20, 0x0c, 0x0c, 0x18, 0x0f, 0x1c,
+	0x81, 0x05, 0x20, 0x0c, 0x0c, 0x18, 0x0e, 0x1c, 0x81, 0x00, 0x20, 0x82, 0x01, 0x0e, 0x0c, 0x81,
+	0x00, 0x20, 0x82, 0x01, 0x08, 0x0c, 0x81, 0x00, 0x20, 0x82, 0x01, 0x08, 0x0c, 0x81, 0x00, 0x20,
+	0x82, 0x01, 0x09, 0x04, 0x81, 0x00, 0x20, 0x81, 0x02, 0x80, 0x08, 0x04, 0x81, 0x00, 0x20, 0x81,
+	0x02, 0x40, 0x08, 0x04, 0x81, 0x65, 0x20, 0x00, 0x06, 0x30, 0x08, 0x04, 0x00, 0x04, 0x28, 0x00,
+	0x3a, 0x08, 0x08, 0x04, 0x00, 0x02, 0x26, 0x00, 0x01, 0x06, 0x08, 0xc4, 0x01, 0x01, 0x21, 0x0e,
+	0xc1, 0x01, 0x08, 0xe4, 0x83, 0x80, 0x20, 0x9f, 0xfc, 0x01, 0x08, 0xf4, 0x47, 0x60, 0xa0, 0xbf,
+	0x7f, 0x01, 0x08, 0xf4, 0xff, 0x1f, 0xa0, 0xff, 0x07, 0x02, 0x08, 0xf4, 0xff, 0x1f, 0xa0, 0xff,
+	0x02, 0x02, 0x08, 0xf4, 0x47, 0x60, 0xa0, 0x3f, 0x0c, 0x04, 0x08, 0xe4, 0x83, 0x80, 0x20, 0x1f,
+	0x10, 0x38, 0x08, 0xc4, 0x01, 0x01, 0x21, 0x0e, 0x08, 0xc0, 0x09, 0x04, 0x00, 0x02, 0x26, 0x00,
+	0x08, 0x00, 0x08, 0x04, 0x00, 0x04, 0x28, 0x00, 0x04, 0x00, 0x08, 0x04, 0x81, 0x00, 0x20, 0x82,
+	0x01, 0x08, 0x04, 0x81, 0x00, 0x20, 0x82, 0x01, 0x08, 0x04, 0x81, 0x00, 0x20, 0x82, 0x01, 0x08,
+	0x04, 0x81, 0x00, 0x20, 0x82, 0x01, 0x08, 0x0c, 0x81, 0x05, 0x20, 0x0c, 0x00, 0x18, 0x08, 0x0c,
+	0x81, 0x05, 0x20, 0x0c, 0x00, 0x18, 0x08, 0x0c, 0x81, 0x05, 0x20, 0x0e, 0x18, 0x38, 0x0e, 0x0c,
+	0x81, 0x05, 0x20, 0x06, 0x18, 0x30, 0x0e, 0x3c, 0x81, 0x14, 0x20, 0x07, 0x18, 0xf0, 0x0f, 0xfc,
+	0x01, 0x00, 0x20, 0x03, 0x18, 0xe0, 0x0f, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0x82,
+	0x03, 0x80, 0x03, 0x18, 0xe0, 0x83, 0x03, 0x80, 0x01, 0x18, 0xc0, 0x83, 0x03, 0xc0, 0x01, 0x18,
+	0xc0, 0x83, 0x04, 0xc0, 0x00, 0x1c, 0xc0, 0x01, 0x82, 0x04, 0xe0, 0x00, 0x0c, 0x80, 0x01, 0x82,
+	0x04, 0x60, 0x00, 0x0c, 0x80, 0x03, 0x82, 0x04, 0x60, 0x00, 0x0c, 0x00, 0x03, 0x82, 0x04, 0x70,
+	0x00, 0x0c, 0x00, 0x03, 0x82, 0x04, 0x30, 0x00, 0x0c, 0x00, 0x07, 0x82, 0x04, 0x38, 0x00, 0x0c,
+	0x00, 0x06, 0x82, 0x04, 0x18, 0x00, 0x0c, 0x00, 0x06, 0x82, 0x02, 0x18, 0x00, 0x0c, 0xff, 0xff,
+	0xff, 0xff, 0xa1
+};
+
+// 'sinalSStop', 64x128px, 403 bytes (RLE)
+const unsigned char epd_rle_sinalSStop [] = {
+	0x8f, 0x00, 0x30, 0x86, 0x00, 0x30, 0x86, 0x03, 0x70, 0x80, 0x01, 0x18, 0x83, 0x03, 0x60, 0x80,
+	0x01, 0x18, 0x83, 0x03, 0x60, 0x80, 0x01, 0x1c, 0x83, 0x03, 0xe0, 0x80, 0x01, 0x0c, 0x83, 0x03,
+	0xc0, 0x80, 0x01, 0x0e, 0x83, 0x03, 0xc0, 0x80, 0x01, 0x06, 0x83, 0x03, 0xc0, 0x81, 0x01, 0x06,
+	0x83, 0x03, 0x80, 0x81, 0x01, 0x07, 0x83, 0x03, 0x80, 0x83, 0x01, 0x03, 0x84, 0x02, 0x83, 0x81,
+	0x03, 0x83, 0x0b, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xfc, 0x87, 0xc1, 0x21, 0x81,
+	0x05, 0xc0, 0x0f, 0x7c, 0x86, 0xc1, 0x20, 0x82, 0x04, 0x0f, 0x1c, 0x06, 0xc0, 0x20, 0x82, 0x04,
+	0x0e, 0x1c, 0x0e, 0xe0, 0x20, 0x82, 0x04, 0x0e, 0x0c, 0x0c, 0x60, 0x20, 0x82, 0x04, 0x08, 0x0c,
+	0x0c, 0x70, 0x20, 0x82, 0x04, 0x08, 0x0c, 0x00, 0x30, 0x20, 0x82, 0x04, 0x09, 0x04, 0x00, 0x30,
+	0x20, 0x81, 0x02, 0x80, 0x08, 0x04, 0x81, 0x00, 0x20, 0x81, 0x02, 0x40, 0x08, 0x04, 0x81, 0x65,
+	0x20, 0x00, 0x06, 0x30, 0x08, 0x04, 0x00, 0x04, 0x28, 0x00, 0x3a, 0x08, 0x08, 0x04, 0x00, 0x02,
+	0x26, 0x00, 0x01, 0x06, 0x08, 0xc4, 0x01, 0x01, 0x21, 0x0e, 0xc1, 0x01, 0x08, 0xe4, 0x83, 0x80,
+	0x20, 0x9f, 0xfc, 0x01, 0x08, 0xf4, 0x47, 0x60, 0xa0, 0xbf, 0x7f, 0x01, 0x08, 0xf4, 0xff, 0x1f,
+	0xa0, 0xff, 0x07, 0x02, 0x08, 0xf4, 0xff, 0x1f, 0xa0, 0xff, 0x02, 0x02, 0x08, 0xf4, 0x47, 0x60,
+	0xa0, 0x3f, 0x0c, 0x04, 0x08, 0xe4, 0x83, 0x80, 0x20, 0x1f, 0x10, 0x38, 0x08, 0xc4, 0x01, 0x01,
+	0x21, 0x0e, 0x08, 0xc0, 0x09, 0x04, 0x00, 0x02, 0x26, 0x00, 0x08, 0x00, 0x08, 0x04, 0x00, 0x04,
+	0x28, 0x00, 0x04, 0x00, 0x08, 0x04, 0x81, 0x00, 0x20, 0x82, 0x01, 0x08, 0x04, 0x81, 0x00, 0x20,
+	0x82, 0x01, 0x08, 0x04, 0x81, 0x00, 0x20, 0x82, 0x04, 0x08, 0x04, 0x0c, 0x60, 0x20, 0x82, 0x04,
+	0x08, 0x0c, 0x0c, 0x60, 0x20, 0x82, 0x04, 0x08, 0x0c, 0x8e, 0xe1, 0x20, 0x82, 0x04, 0x08, 0x0c,
+	0x86, 0xc1, 0x20, 0x82, 0x04, 0x0e, 0x0c, 0x86, 0xc1, 0x21, 0x82, 0x04, 0x0e, 0x3c, 0x87, 0x81,
+	0x21, 0x81, 0x05, 0x80, 0x0f, 0xfc, 0x83, 0x81, 0x21, 0x81, 0x0d, 0xc0, 0x0f, 0xfc, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0x0f, 0x80, 0x83, 0x01, 0x03, 0x83, 0x03, 0x80, 0x81, 0x01, 0x07, 0x83,
+	0x03, 0xc0, 0x81, 0x01, 0x06, 0x83, 0x03, 0xc0, 0x80, 0x01, 0x0e, 0x83, 0x03, 0xc0, 0x80, 0x01,
+	0x0c, 0x83, 0x03, 0xe0, 0x80, 0x01, 0x0c, 0x83, 0x03, 0x60, 0x80, 0x01, 0x1c, 0x83, 0x03, 0x60,
+	0x80, 0x01, 0x18, 0x83, 0x03, 0x70, 0x80, 0x01, 0x38, 0x83, 0x00, 0x30, 0x81, 0x00, 0x30, 0x83,
+	0x00, 0x30, 0x81, 0x00, 0x30, 0x83, 0x00, 0x38, 0x86, 0x00, 0x18, 0x86, 0x00, 0x18, 0xff, 0xff,
+	0xff, 0xff, 0x96
+};
+
+// 'noturnoOne', 64x128px, 157 bytes (RLE)
+const unsigned char epd_rle_noturnoOne [] = {
+	0xff, 0xed, 0x00, 0x03, 0x85, 0x01, 0xe0, 0x0f, 0x86, 0x00, 0x43, 0x86, 0x01, 0xf0, 0x01, 0x85,
+	0x00, 0x64, 0x86, 0x00, 0x04, 0x86, 0x00, 0x0e, 0x85, 0x01, 0x80, 0x3f, 0x86, 0x00, 0x0e, 0x86,
+	0x00, 0x04, 0x86, 0x00, 0x04, 0xe5, 0x00, 0x38, 0x86, 0x00, 0xf0, 0x86, 0x01, 0xe0, 0x01, 0x85,
+	0x01, 0xc0, 0x03, 0x85, 0x01, 0xc0, 0x07, 0x85, 0x01, 0x80, 0x07, 0x85, 0x01, 0x80, 0x0f, 0x85,
+	0x01, 0x80, 0x0f, 0x85, 0x01, 0x80, 0x0f, 0x85, 0x01, 0x80, 0x0f, 0x84, 0x02, 0x02, 0xc0, 0x0f,
+	0x84, 0x02, 0x06, 0xc0, 0x0f, 0x84, 0x02, 0x0e, 0xe0, 0x0f, 0x84, 0x02, 0x3c, 0xf8, 0x07, 0x84,
+	0x02, 0xfc, 0xff, 0x07, 0x84, 0x02, 0xf8, 0xff, 0x03, 0x84, 0x02, 0xf0, 0xff, 0x01, 0x84, 0x01,
+	0xe0, 0xff, 0x85, 0x01, 0x80, 0x3f, 0xfd, 0x00, 0x04, 0x86, 0x00, 0x0c, 0x85, 0x01, 0x80, 0x3f,
+	0x86, 0x01, 0x8c, 0x01, 0x85, 0x01, 0xc4, 0x03, 0x85, 0x01, 0x80, 0x01, 0x85, 0x00, 0x10, 0x86,
+	0x00, 0x38, 0x86, 0x00, 0x7e, 0x86, 0x00, 0x38, 0x86, 0x00, 0x10, 0xff, 0xfa
+};
+
+// 'noturnoTwo', 64x128px, 153 bytes (RLE)
+const unsigned char epd_rle_noturnoTwo [] = {
+	0xff, 0xeb, 0x00, 0x0c, 0x85, 0x01, 0x80, 0x3f, 0x86, 0x01, 0x8c, 0x01, 0x85, 0x01, 0xc0, 0x07,
+	0x85, 0x01, 0x90, 0x01, 0x85, 0x00, 0x10, 0x86, 0x00, 0x38, 0x86, 0x00, 0xfe, 0x86, 0x00, 0x38,
+	0x86, 0x00, 0x10, 0xef, 0x00, 0x38, 0x86, 0x00, 0xf0, 0x86, 0x01, 0xe0, 0x01, 0x85, 0x01, 0xc0,
+	0x03, 0x85, 0x01, 0xc0, 0x07, 0x85, 0x01, 0x80, 0x07, 0x85, 0x01, 0x80, 0x0f, 0x85, 0x01, 0x80,
+	0x0f, 0x85, 0x01, 0x80, 0x0f, 0x85, 0x01, 0x80, 0x0f, 0x84, 0x02, 0x02, 0xc0, 0x0f, 0x84, 0x02,
+	0x06, 0xc0, 0x0f, 0x84, 0x02, 0x0e, 0xe0, 0x0f, 0x84, 0x02, 0x3c, 0xf8, 0x07, 0x84, 0x02, 0xfc,
+	0xff, 0x07, 0x84, 0x02, 0xf8, 0xff, 0x03, 0x84, 0x02, 0xf0, 0xff, 0x01, 0x84, 0x01, 0xe0, 0xff,
+	0x85, 0x01, 0x80, 0x3f, 0xff, 0x8f, 0x00, 0x02, 0x85, 0x01, 0xe0, 0x0f, 0x86, 0x00, 0x43, 0x86,
+	0x00, 0xe0, 0x86, 0x00, 0xf0, 0x86, 0x00, 0x44, 0x86, 0x00, 0x0e, 0x86, 0x00, 0x1f, 0x86, 0x00,
+	0x1e, 0x86, 0x00, 0x0c, 0x86, 0x00, 0x04, 0xff, 0xe8
+};
+
+// 'startFour', 64x128px, 359 bytes (RLE)
+const unsigned char epd_rle_startFour [] = {
+	0xff, 0x80, 0x01, 0x10, 0x02, 0x85, 0x01, 0xf0, 0x03, 0x85, 0x01, 0xf0, 0x03, 0x85, 0x01, 0x10,
+	0x02, 0x85, 0x00, 0x10, 0x8e, 0x01, 0xc0, 0x03, 0x85, 0x00, 0x40, 0x86, 0x00, 0x40, 0x86, 0x00,
+	0x40, 0x86, 0x01, 0xc0, 0x03, 0x85, 0x01, 0x80, 0x03, 0x8d, 0x00, 0x40, 0x86, 0x00, 0x40, 0x86,
+	0x01, 0xf0, 0x03, 0x85, 0x01, 0xe0, 0x03, 0x85, 0x00, 0x40, 0x8e, 0x01, 0x80, 0x03, 0x85, 0x01,
+	0xc0, 0x03, 0x85, 0x01, 0x40, 0x03, 0x85, 0x01, 0xc0, 0x03, 0x85, 0x01, 0xc0, 0x03, 0x85, 0x00,
+	0x80, 0x97, 0x00, 0x02, 0x85, 0x01, 0xf0, 0x03, 0x85, 0x01, 0xf0, 0x03, 0x86, 0x01, 0xf2, 0x03,
+	0x85, 0x01, 0xe0, 0x03, 0x86, 0x00, 0x02, 0x85, 0x01, 0x02, 0x02, 0x84, 0x02, 0x10, 0x02, 0x02,
+	0x84, 0x01, 0xf0, 0x03, 0x85, 0x05, 0xe0, 0x03, 0x80, 0x00, 0x01, 0x03, 0x82, 0x04, 0x02, 0x82,
+	0x01, 0x03, 0x03, 0x82, 0x04, 0xc0, 0x83, 0x01, 0x03, 0x07, 0x82, 0x01, 0xd0, 0x03, 0x85, 0x04,
+	0x02, 0xc2, 0xfc, 0xf9, 0x7b, 0x81, 0x05, 0xc0, 0x03, 0xc0, 0xfc, 0xf9, 0xf9, 0x81, 0x05, 0xd0,
+	0x83, 0x40, 0xf0, 0xe0, 0x40, 0x82, 0x05, 0xc2, 0x05, 0x60, 0xce, 0x40, 0x02, 0x81, 0x05, 0x42,
+	0x07, 0x40, 0x5f, 0x00, 0x02, 0x81, 0x05, 0x40, 0x04, 0x00, 0x1f, 0x00, 0x02, 0x81, 0x14, 0x40,
+	0x07, 0x40, 0x5f, 0x00, 0x02, 0x00, 0x10, 0xc0, 0x07, 0x60, 0xde, 0x40, 0x02, 0x00, 0xf0, 0x03,
+	0x40, 0xe0, 0xe0, 0x40, 0x81, 0x05, 0xf0, 0xf3, 0xc3, 0xfc, 0xf9, 0xf1, 0x81, 0x05, 0x10, 0xe0,
+	0xc3, 0xfd, 0xf9, 0x7b, 0x82, 0x00, 0x40, 0x86, 0x04, 0x40, 0x80, 0x01, 0x03, 0x07, 0x81, 0x05,
+	0xc0, 0xc3, 0x83, 0x01, 0x03, 0x03, 0x81, 0x05, 0xc0, 0x83, 0x83, 0x00, 0x01, 0x03, 0x89, 0x00,
+	0x40, 0x86, 0x01, 0x40, 0x40, 0x86, 0x01, 0xf0, 0x03, 0x85, 0x01, 0xf3, 0x03, 0x84, 0x01, 0x40,
+	0x43, 0x85, 0x01, 0xc0, 0x03, 0x85, 0x01, 0x40, 0x03, 0x85, 0x01, 0xc0, 0x03, 0x85, 0x01, 0x80,
+	0x03, 0x95, 0x00, 0x40, 0x86, 0x01, 0xe0, 0x03, 0x85, 0x01, 0xf0, 0x03, 0x85, 0x00, 0x50, 0x96,
+	0x00, 0x40, 0x86, 0x00, 0x40, 0x86, 0x01, 0xe0, 0x03, 0x85, 0x01, 0xf0, 0x03, 0x85, 0x00, 0x50,
+	0x97, 0x00, 0x02, 0x85, 0x01, 0xc0, 0x03, 0x85, 0x01, 0xd0, 0x03, 0x86, 0x00, 0x02, 0x86, 0x00,
+	0x02, 0x8d, 0x01, 0xc0, 0x03, 0x85, 0x01, 0x40, 0x02, 0x85, 0x01, 0x40, 0x02, 0x85, 0x01, 0x40,
+	0x02, 0x85, 0x01, 0x40, 0x02, 0xff, 0xac
+};
+
+// 'startOne', 64x128px, 272 bytes (RLE)
+const unsigned char epd_rle_startOne [] = {
+	0xff, 0x81, 0x01, 0x80, 0x10, 0x85, 0x01, 0x80, 0x1f, 0x85, 0x01, 0x80, 0x1f, 0x85, 0x01, 0x80,
+	0x10, 0x85, 0x00, 0x80, 0x8f, 0x00, 0x1e, 0x86, 0x00, 0x02, 0x86, 0x00, 0x02, 0x86, 0x00, 0x02,
+	0x86, 0x00, 0x1e, 0x86, 0x00, 0x1c, 0x8e, 0x00, 0x02, 0x86, 0x00, 0x02, 0x85, 0x01, 0x80, 0x1f,
+	0x86, 0x00, 0x1f, 0x86, 0x00, 0x02, 0x8e, 0x00, 0x1c, 0x86, 0x00, 0x1e, 0x86, 0x00, 0x1a, 0x86,
+	0x00, 0x1e, 0x86, 0x00, 0x1e, 0x86, 0x00, 0x04, 0x96, 0x00, 0x10, 0x85, 0x01, 0x80, 0x1f, 0x85,
+	0x01, 0x80, 0x1f, 0x86, 0x01, 0x10, 0x3f, 0x86, 0x00, 0x3e, 0x86, 0x00, 0x20, 0x85, 0x01, 0x10,
+	0x20, 0x84, 0x02, 0x80, 0x10, 0x20, 0x84, 0x01, 0x80, 0x1f, 0x86, 0x00, 0x1f, 0x86, 0x01, 0x10,
+	0x20, 0x86, 0x00, 0x3c, 0x86, 0x00, 0x3d, 0x85, 0x01, 0x10, 0x20, 0x85, 0x00, 0x1e, 0x85, 0x02,
+	0x80, 0x1e, 0x08, 0x85, 0x01, 0x10, 0x5c, 0x85, 0x01, 0x10, 0x74, 0x86, 0x00, 0x44, 0x86, 0x00,
+	0x74, 0x84, 0x02, 0x80, 0x00, 0x7c, 0x84, 0x01, 0x80, 0x1f, 0x85, 0x02, 0x80, 0x1f, 0x3f, 0x84,
+	0x02, 0x80, 0x00, 0x3e, 0x86, 0x00, 0x04, 0x86, 0x00, 0x04, 0x85, 0x01, 0x1e, 0x3c, 0x85, 0x01,
+	0x1e, 0x38, 0x8d, 0x00, 0x02, 0x86, 0x01, 0x02, 0x04, 0x86, 0x00, 0x3f, 0x85, 0x01, 0x18, 0x3f,
+	0x85, 0x01, 0x1a, 0x04, 0x85, 0x00, 0x1e, 0x86, 0x00, 0x1a, 0x86, 0x00, 0x1e, 0x86, 0x00, 0x1c,
+	0x96, 0x00, 0x02, 0x86, 0x00, 0x1f, 0x85, 0x01, 0x80, 0x1f, 0x85, 0x01, 0x80, 0x02, 0x96, 0x00,
+	0x02, 0x86, 0x00, 0x02, 0x86, 0x00, 0x1f, 0x85, 0x01, 0x80, 0x1f, 0x85, 0x01, 0x80, 0x02, 0x96,
+	0x00, 0x10, 0x86, 0x00, 0x1e, 0x85, 0x01, 0x80, 0x1e, 0x86, 0x00, 0x10, 0x86, 0x00, 0x10, 0x8e,
+	0x00, 0x1e, 0x86, 0x00, 0x12, 0x86, 0x00, 0x12, 0x86, 0x00, 0x12, 0x86, 0x00, 0x12, 0xff, 0xab
+};
+
+// 'startPress', 64x128px, 359 bytes (RLE)
+const unsigned char epd_rle_startPress [] = {
+	0xf8, 0x01, 0xf0, 0x03, 0x85, 0x01, 0xf0, 0x03, 0x85, 0x01, 0x10, 0x01, 0x85, 0x01, 0x10, 0x01,
+	0x85, 0x01, 0xf0, 0x01, 0x85, 0x00, 0xe0, 0x96, 0x01, 0xc0, 0x03, 0x85, 0x00, 0x80, 0x86, 0x00,
+	0x40, 0x86, 0x00, 0x40, 0x8e, 0x01, 0x80, 0x01, 0x85, 0x01, 0xc0, 0x43, 0x85, 0x01, 0xc0, 0x43,
+	0x85, 0x02, 0x40, 0xe3, 0x03, 0x84, 0x02, 0xc0, 0xf3, 0x03, 0x84, 0x01, 0xc0, 0x51, 0x8d, 0x02,
+	0x80, 0x82, 0x03, 0x84, 0x02, 0xc0, 0xc3, 0x03, 0x84, 0x02, 0x40, 0x43, 0x02, 0x84, 0x02, 0xc0,
+	0x43, 0x02, 0x84, 0x02, 0x40, 0xc3, 0x03, 0x85, 0x01, 0x81, 0x01, 0x8c, 0x01, 0xc0, 0x02, 0x85,
+	0x02, 0xc0, 0xc3, 0x03, 0x84, 0x01, 0x40, 0x83, 0x85, 0x01, 0xc0, 0x43, 0x85, 0x01, 0x40, 0x43,
+	0xaf, 0x03, 0x80, 0x00, 0x01, 0x03, 0x83, 0x03, 0x80, 0x01, 0x03, 0x03, 0x83, 0x03, 0x80, 0x01,
+	0x03, 0x07, 0x81, 0x02, 0xf0, 0x83, 0x02, 0x84, 0x05, 0xf0, 0xc3, 0xc3, 0xfc, 0xf9, 0x7b, 0x81,
+	0x05, 0x90, 0x42, 0xc3, 0xfc, 0xf9, 0xf9, 0x81, 0x05, 0x90, 0xc2, 0x43, 0xf0, 0xe0, 0x40, 0x81,
+	0x0e, 0xf0, 0x43, 0x03, 0x60, 0xce, 0x40, 0x02, 0x00, 0x60, 0x01, 0x00, 0x40, 0x5f, 0x00, 0x02,
+	0x84, 0x0a, 0x1f, 0x00, 0x02, 0x00, 0xc0, 0x03, 0x00, 0x40, 0x5f, 0x00, 0x02, 0x81, 0x05, 0x42,
+	0x00, 0x60, 0xde, 0x40, 0x02, 0x81, 0x04, 0xf2, 0x43, 0xe0, 0xe0, 0x40, 0x82, 0x04, 0xf2, 0xc3,
+	0xfc, 0xf9, 0xf1, 0x81, 0x05, 0xc0, 0x43, 0xc0, 0xfd, 0xf9, 0x7b, 0x81, 0x01, 0xc0, 0x03, 0x87,
+	0x03, 0x80, 0x01, 0x03, 0x07, 0x81, 0x05, 0x40, 0x40, 0x83, 0x01, 0x03, 0x03, 0x81, 0x05, 0x40,
+	0xc0, 0x83, 0x00, 0x01, 0x03, 0x81, 0x02, 0xf0, 0x43, 0x02, 0x84, 0x02, 0xe0, 0xc3, 0x03, 0x84,
+	0x02, 0x40, 0xc0, 0x03, 0x94, 0x02, 0x40, 0xc0, 0x03, 0x84, 0x02, 0xe0, 0xc3, 0x03, 0x84, 0x01,
+	0xf0, 0x43, 0x85, 0x01, 0x40, 0x40, 0x85, 0x01, 0x40, 0x40, 0x8d, 0x01, 0xc0, 0x03, 0x85, 0x01,
+	0x40, 0x42, 0x85, 0x02, 0x40, 0xf2, 0x03, 0x84, 0x02, 0x40, 0xf2, 0x03, 0x84, 0x01, 0xc0, 0x43,
+	0x85, 0x01, 0x80, 0x01, 0x85, 0x01, 0xc0, 0x03, 0x85, 0x01, 0xc0, 0x03, 0x85, 0x02, 0x40, 0xf0,
+	0x02, 0x84, 0x01, 0x40, 0xf0, 0x85, 0x01, 0xc0, 0x21, 0x85, 0x01, 0xc0, 0x03, 0xc5, 0x01, 0xf0,
+	0x03, 0x85, 0x01, 0xf0, 0x02, 0x85, 0x01, 0x90, 0x02, 0x85, 0x01, 0x90, 0x02, 0x85, 0x01, 0xe0,
+	0x03, 0x85, 0x01, 0x20, 0x01, 0xff, 0xa4
+};
+
+// 'startThree', 64x128px, 253 bytes (RLE)
+const unsigned char epd_rle_startThree [] = {
+	0xff, 0x81, 0x00, 0x21, 0x86, 0x00, 0x3f, 0x86, 0x00, 0x3f, 0x86, 0x00, 0x21, 0x86, 0x00, 0x01,
+	0x8e, 0x00, 0x3c, 0x86, 0x00, 0x04, 0x86, 0x00, 0x04, 0x86, 0x00, 0x04, 0x86, 0x00, 0x3c, 0x86,
+	0x00, 0x38, 0x8e, 0x00, 0x04, 0x86, 0x00, 0x04, 0x86, 0x00, 0x3f, 0x86, 0x00, 0x3e, 0x86, 0x00,
+	0x04, 0x8e, 0x00, 0x38, 0x86, 0x00, 0x3c, 0x86, 0x00, 0x34, 0x86, 0x00, 0x3c, 0x86, 0x00, 0x3c,
+	0x86, 0x00, 0x08, 0x96, 0x00, 0x20, 0x86, 0x00, 0x3f, 0x86, 0x00, 0x3f, 0x86, 0x01, 0x20, 0x3f,
+	0x86, 0x00, 0x3e, 0x86, 0x00, 0x20, 0x85, 0x01, 0x20, 0x20, 0x85, 0x01, 0x21, 0x20, 0x85, 0x00,
+	0x3f, 0x86, 0x00, 0x3e, 0x86, 0x01, 0x20, 0x20, 0x86, 0x00, 0x3c, 0x86, 0x00, 0x3d, 0x85, 0x01,
+	0x20, 0x20, 0x85, 0x00, 0x3c, 0x86, 0x01, 0x3d, 0x08, 0x85, 0x01, 0x20, 0x5c, 0x85, 0x01, 0x20,
+	0x74, 0x86, 0x00, 0x44, 0x86, 0x00, 0x74, 0x85, 0x01, 0x01, 0x7c, 0x85, 0x00, 0x3f, 0x86, 0x01,
+	0x3f, 0x3f, 0x85, 0x01, 0x01, 0x3e, 0x86, 0x00, 0x04, 0x86, 0x00, 0x04, 0x85, 0x01, 0x3c, 0x3c,
+	0x85, 0x01, 0x3c, 0x38, 0x8d, 0x00, 0x04, 0x86, 0x01, 0x04, 0x04, 0x86, 0x00, 0x3f, 0x85, 0x01,
+	0x30, 0x3f, 0x85, 0x01, 0x34, 0x04, 0x85, 0x00, 0x3c, 0x86, 0x00, 0x34, 0x86, 0x00, 0x3c, 0x86,
+	0x00, 0x38, 0x96, 0x00, 0x04, 0x86, 0x00, 0x3e, 0x86, 0x00, 0x3f, 0x86, 0x00, 0x05, 0x96, 0x00,
+	0x04, 0x86, 0x00, 0x04, 0x86, 0x00, 0x3e, 0x86, 0x00, 0x3f, 0x86, 0x00, 0x05, 0x96, 0x00, 0x20,
+	0x86, 0x00, 0x3c, 0x86, 0x00, 0x3d, 0x86, 0x00, 0x20, 0x86, 0x00, 0x20, 0x8e, 0x00, 0x3c, 0x86,
+	0x00, 0x24, 0x86, 0x00, 0x24, 0x86, 0x00, 0x24, 0x86, 0x00, 0x24, 0xff, 0xac
+};
+
+// 'startTwo', 64x128px, 300 bytes (RLE)
+const unsigned char epd_rle_startTwo [] = {
+	0xff, 0x81, 0x01, 0x10, 0x02, 0x85, 0x01, 0xf0, 0x03, 0x85, 0x01, 0xf0, 0x03, 0x85, 0x01, 0x10,
+	0x02, 0x85, 0x00, 0x10, 0x8e, 0x01, 0xc0, 0x03, 0x85, 0x00, 0x40, 0x86, 0x00, 0x40, 0x86, 0x00,
+	0x40, 0x86, 0x01, 0xc0, 0x03, 0x85, 0x01, 0x80, 0x03, 0x8d, 0x00, 0x40, 0x86, 0x00, 0x40, 0x86,
+	0x01, 0xf0, 0x03, 0x85, 0x01, 0xe0, 0x03, 0x85, 0x00, 0x40, 0x8e, 0x01, 0x80, 0x03, 0x85, 0x01,
+	0xc0, 0x03, 0x85, 0x01, 0x40, 0x03, 0x85, 0x01, 0xc0, 0x03, 0x85, 0x01, 0xc0, 0x03, 0x85, 0x00,
+	0x80, 0x97, 0x00, 0x02, 0x85, 0x01, 0xf0, 0x03, 0x85, 0x01, 0xf0, 0x03, 0x86, 0x01, 0xf2, 0x03,
+	0x85, 0x01, 0xe0, 0x03, 0x86, 0x00, 0x02, 0x85, 0x01, 0x02, 0x02, 0x84, 0x02, 0x10, 0x02, 0x02,
+	0x84, 0x01, 0xf0, 0x03, 0x85, 0x01, 0xe0, 0x03, 0x86, 0x01, 0x02, 0x02, 0x85, 0x01, 0xc0, 0x03,
+	0x85, 0x01, 0xd0, 0x03, 0x85, 0x01, 0x02, 0x02, 0x84, 0x01, 0xc0, 0x03, 0x85, 0x01, 0xd0, 0x83,
+	0x86, 0x01, 0xc2, 0x05, 0x85, 0x01, 0x42, 0x07, 0x85, 0x01, 0x40, 0x04, 0x85, 0x01, 0x40, 0x07,
+	0x84, 0x02, 0x10, 0xc0, 0x07, 0x84, 0x01, 0xf0, 0x03, 0x85, 0x02, 0xf0, 0xf3, 0x03, 0x84, 0x02,
+	0x10, 0xe0, 0x03, 0x85, 0x00, 0x40, 0x86, 0x00, 0x40, 0x85, 0x02, 0xc0, 0xc3, 0x03, 0x84, 0x02,
+	0xc0, 0x83, 0x03, 0x8c, 0x00, 0x40, 0x86, 0x01, 0x40, 0x40, 0x86, 0x01, 0xf0, 0x03, 0x85, 0x01,
+	0xf3, 0x03, 0x84, 0x01, 0x40, 0x43, 0x85, 0x01, 0xc0, 0x03, 0x85, 0x01, 0x40, 0x03, 0x85, 0x01,
+	0xc0, 0x03, 0x85, 0x01, 0x80, 0x03, 0x95, 0x00, 0x40, 0x86, 0x01, 0xe0, 0x03, 0x85, 0x01, 0xf0,
+	0x03, 0x85, 0x00, 0x50, 0x96, 0x00, 0x40, 0x86, 0x00, 0x40, 0x86, 0x01, 0xe0, 0x03, 0x85, 0x01,
+	0xf0, 0x03, 0x85, 0x00, 0x50, 0x97, 0x00, 0x02, 0x85, 0x01, 0xc0, 0x03, 0x85, 0x01, 0xd0, 0x03,
+	0x86, 0x00, 0x02, 0x86, 0x00, 0x02, 0x8d, 0x01, 0xc0, 0x03, 0x85, 0x01, 0x40, 0x02, 0x85, 0x01,
+	0x40, 0x02, 0x85, 0x01, 0x40, 0x02, 0x85, 0x01, 0x40, 0x02, 0xff, 0xab
+};
+
+// 'blindOne' -> 'blindTwo', 106 bytes (delta)
+static const unsigned char epd_delta_blind_0 [] = {
+	0x02, 0x13, 0x05, 0x5c, 0x58, 0x58, 0x51, 0xf1, 0x03, 0x20, 0x02, 0x60, 0x44, 0x04, 0x26, 0x08,
+	0x07, 0x18, 0x20, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x05, 0x16, 0x04, 0x07, 0x38, 0xe0, 0x80, 0x05,
+	0x2a, 0x0d, 0x03, 0x04, 0x18, 0x60, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
+	0x15, 0x0f, 0xe0, 0xf0, 0x90, 0x98, 0x9f, 0x8c, 0x08, 0x08, 0x08, 0x08, 0x04, 0x04, 0x0c, 0x98,
+	0xf0, 0x06, 0x2f, 0x05, 0x03, 0x0c, 0x10, 0x60, 0x80, 0x06, 0x37, 0x09, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x1b, 0x08, 0x04, 0x02, 0x01, 0x02, 0x03, 0x01, 0x01, 0x01,
+	0x07, 0x33, 0x02, 0x01, 0x02, 0x07, 0x40, 0x01, 0x00, 0xff
+};
+
+// 'blindTwo' -> 'blindThree', 98 bytes (delta)
+static const unsigned char epd_delta_blind_1 [] = {
+	0x03, 0x20, 0x02, 0x66, 0x4c, 0x04, 0x26, 0x08, 0x01, 0x03, 0x06, 0x1c, 0x18, 0x30, 0x60, 0x80,
+	0x05, 0x16, 0x04, 0x01, 0x00, 0x00, 0x00, 0x05, 0x2a, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02,
+	0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80, 0x06, 0x15, 0x0f, 0xc0, 0xc0, 0x80, 0x80, 0x80, 0x80,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x2f, 0x05, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x06, 0x37, 0x09, 0x01, 0x02, 0x04, 0x08, 0x08, 0x10, 0x20, 0x40, 0x80, 0x07, 0x1b, 0x08,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x33, 0x02, 0x00, 0x00, 0x07, 0x40, 0x01,
+	0x01, 0xff
+};
+
+// 'blindThree' -> 'blindOne', 9 bytes (delta)
+static const unsigned char epd_delta_blind_2 [] = {
+	0x02, 0x13, 0x05, 0x40, 0x40, 0x40, 0x41, 0xe1, 0xff
+};
+
+static const unsigned char *const epd_deltas_blind[] = {epd_delta_blind_0, epd_delta_blind_1, epd_delta_blind_2};
+
+// 'sinal' -> 'sinalPass', 149 bytes (delta)
+static const unsigned char epd_delta_sinalVerde_0 [] = {
+	0x03, 0x01, 0x0a, 0x30, 0x30, 0x70, 0x60, 0xe0, 0xc0, 0xc0, 0xc0, 0x80, 0x80, 0x03, 0x30, 0x0c,
+	0x80, 0x80, 0xc0, 0xc0, 0xe0, 0x60, 0x60, 0x70, 0x30, 0x38, 0x18, 0x18, 0x04, 0x08, 0x0a, 0x01,
+	0x01, 0x03, 0x03, 0x03, 0x07, 0xff, 0x0e, 0x0c, 0x0c, 0x04, 0x29, 0x0a, 0x0c, 0x0c, 0x0e, 0x06,
+	0x07, 0x03, 0xff, 0x03, 0x01, 0x01, 0x05, 0x02, 0x10, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c,
+	0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0xff, 0x0c, 0x0c, 0x0c, 0x05, 0x2b, 0x11, 0x18, 0x18, 0x18, 0x18,
+	0xff, 0x18, 0x18, 0x18, 0x1c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x06, 0x06, 0x0c,
+	0x80, 0x80, 0x80, 0xc0, 0xc0, 0xe0, 0x60, 0x70, 0xff, 0xf8, 0x18, 0x18, 0x06, 0x29, 0x0d, 0x18,
+	0x18, 0x38, 0x30, 0xf0, 0xe0, 0xff, 0xe0, 0xc0, 0xc0, 0xc0, 0x80, 0x80, 0x07, 0x00, 0x0a, 0x0c,
+	0x0c, 0x0e, 0x06, 0x07, 0x03, 0x03, 0x01, 0x01, 0x01, 0x07, 0x33, 0x08, 0x01, 0x01, 0x03, 0x03,
+	0x03, 0x07, 0x06, 0x06, 0xff
+};
+
+// 'sinalPass' -> 'sinal', 149 bytes (delta)
+static const unsigned char epd_delta_sinalVerde_1 [] = {
+	0x03, 0x01, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x30, 0x0c,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x08, 0x0a, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x04, 0x29, 0x0a, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x05, 0x02, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x05, 0x2b, 0x11, 0x00, 0x00, 0x00, 0x00,
+	0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x06, 0x0c,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xc0, 0x00, 0x00, 0x06, 0x29, 0x0d, 0x00,
+	0x00, 0x00, 0x00, 0x80, 0xc0, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x0a, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x33, 0x08, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xff
+};
+
+static const unsigned char *const epd_deltas_sinalVerde[] = {epd_delta_sinalVerde_0, epd_delta_sinalVerde_1};
+
+// 'sinal' -> 'sinalSStop', 147 bytes (delta)
+static const unsigned char epd_delta_sinalVermelho_0 [] = {
+	0x00, 0x02, 0x0b, 0x30, 0x30, 0x70, 0x60, 0x60, 0xe0, 0xc0, 0xc0, 0xc0, 0x80, 0x80, 0x00, 0x30,
+	0x0e, 0x80, 0x80, 0xc0, 0xc0, 0xc0, 0xe0, 0x60, 0x60, 0x70, 0x30, 0x30, 0x38, 0x18, 0x18, 0x01,
+	0x04, 0x11, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x83, 0x83, 0xff, 0x87, 0x86, 0x06,
+	0x0e, 0x0c, 0x0c, 0x01, 0x28, 0x11, 0x0c, 0x0c, 0x8e, 0x86, 0x86, 0x87, 0x83, 0xff, 0x83, 0x81,
+	0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x02, 0x04, 0x13, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x81, 0xff, 0xc1, 0xc1, 0xc0, 0xe0, 0x60, 0x70, 0x30, 0x30, 0x02, 0x28, 0x11,
+	0x60, 0x60, 0xe1, 0xc1, 0xc1, 0x81, 0x81, 0xff, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x03, 0x04, 0x0c, 0x18, 0x18, 0x1c, 0x0c, 0x0e, 0x06, 0x06, 0x07, 0x03, 0x03, 0xff, 0x21,
+	0x03, 0x2c, 0x0f, 0x21, 0x21, 0x21, 0xff, 0x03, 0x07, 0x06, 0x0e, 0x0c, 0x0c, 0x1c, 0x18, 0x38,
+	0x30, 0x30, 0xff
+};
+
+// 'sinalSStop' -> 'sinal', 147 bytes (delta)
+static const unsigned char epd_delta_sinalVermelho_1 [] = {
+	0x00, 0x02, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30,
+	0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+	0x04, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x01, 0x28, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x04, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x28, 0x11,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x03, 0x04, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x20,
+	0x03, 0x2c, 0x0f, 0x20, 0x20, 0x20, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xff
+};
+
+static const unsigned char *const epd_deltas_sinalVermelho[] = {epd_delta_sinalVermelho_0, epd_delta_sinalVermelho_1};
+
+// 'noturnoOne' -> 'noturnoTwo', 84 bytes (delta)
+static const unsigned char epd_delta_noturno_0 [] = {
+	0x03, 0x1e, 0x01, 0x80, 0x03, 0x58, 0x01, 0x00, 0x04, 0x1d, 0x0a, 0x0c, 0x3f, 0x8c, 0xc0, 0x90,
+	0x10, 0x38, 0xfe, 0x38, 0x10, 0x04, 0x56, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x05, 0x1e, 0x07, 0x00, 0x01, 0x07, 0x01, 0x00, 0x00, 0x00, 0x05, 0x59, 0x03,
+	0xe0, 0x00, 0x00, 0x06, 0x1d, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x06, 0x58, 0x0b, 0x02, 0x0f, 0x43, 0xe0, 0xf0, 0x44, 0x0e, 0x1f, 0x1e, 0x0c, 0x04, 0x07,
+	0x20, 0x01, 0x00, 0xff
+};
+
+// 'noturnoTwo' -> 'noturnoOne', 84 bytes (delta)
+static const unsigned char epd_delta_noturno_1 [] = {
+	0x03, 0x1e, 0x01, 0x00, 0x03, 0x58, 0x01, 0x80, 0x04, 0x1d, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x56, 0x0b, 0x04, 0x0c, 0x3f, 0x8c, 0xc4, 0x80, 0x10, 0x38,
+	0x7e, 0x38, 0x10, 0x05, 0x1e, 0x07, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x05, 0x59, 0x03,
+	0x01, 0x03, 0x01, 0x06, 0x1d, 0x0b, 0x03, 0x0f, 0x43, 0xf0, 0x64, 0x04, 0x0e, 0x3f, 0x0e, 0x04,
+	0x04, 0x06, 0x58, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
+	0x20, 0x01, 0x01, 0xff
+};
+
+static const unsigned char *const epd_deltas_noturno[] = {epd_delta_noturno_0, epd_delta_noturno_1};
+
+const bitmap_sequence_t epd_seq_blind = {epd_rle_blindOne, epd_deltas_blind, 3};
+const bitmap_sequence_t epd_seq_sinalVerde = {epd_rle_sinal, epd_deltas_sinalVerde, 2};
+const bitmap_sequence_t epd_seq_sinalVermelho = {epd_rle_sinal, epd_deltas_sinalVermelho, 2};
+const bitmap_sequence_t epd_seq_noturno = {epd_rle_noturnoOne, epd_deltas_noturno, 2};
+const bitmap_sequence_t epd_seq_sinal = {epd_rle_sinal, NULL, 1};
+const bitmap_sequence_t epd_seq_blindOne = {epd_rle_blindOne, NULL, 1};
+const bitmap_sequence_t epd_seq_blindThree = {epd_rle_blindThree, NULL, 1};
+
+// Total de bytes compactados = 4782 (original: 13312)
@@ -0,0 +1,24 @@
+#include "cena.h"
+
+Cena cena_do_estado(const SemaforoEstado *estado) {
+    if (estado->modo_noturno)
+        return (Cena){&epd_seq_noturno, TEMPO_ALTERNANCIA_NOTURNO};
+
+    if (estado->exibindo_sinal) {
+        if (estado->estado == ESTADO_VERDE)
+            return (Cena){&epd_seq_sinalVerde, TEMPO_ALTERNANCIA_SINAL};
+        if (estado->estado == ESTADO_VERMELHO)
+            return (Cena){&epd_seq_sinalVermelho, TEMPO_ALTERNANCIA_SINAL};
+        return (Cena){&epd_seq_sinal, TEMPO_ALTERNANCIA_SINAL};
+    }
+
+    switch (estado->estado) {
+        case ESTADO_VERDE:
+            return (Cena){&epd_seq_blind, TEMPO_ANIMACAO};
+        case ESTADO_AMARELO:
+            return (Cena){&epd_seq_blindThree, 0};
+        case ESTADO_VERMELHO:
+        default:
+            return (Cena){&epd_seq_blindOne, 0};
+    }
+}
@@ -0,0 +1,29 @@
+#ifndef CENA_H
+#define CENA_H
+
+// Escolha da cena do display pelo estado do semáforo. A tarefa do display
+// (intellitraffic.c) desenha a cena; o simulador do host usa a mesma escolha
+// para saber quando o display pede quadros.
+
+#include "bitmap.h"
+#include "semaforo.h"
+
+// Período das animações de cada cena, em ms
+#define TEMPO_ANIMACAO 300
+#define TEMPO_ALTERNANCIA_NOTURNO 500
+#define TEMPO_ALTERNANCIA_SINAL 250
+
+typedef struct {
+    const bitmap_sequence_t *seq;
+    uint16_t periodo;
+} Cena;
+
+Cena cena_do_estado(const SemaforoEstado *estado);
+
+// Só as cenas animadas pedem quadros periódicos; as estáticas esperam o aviso
+// de mudança do semáforo
+static inline bool cena_animada(Cena cena) {
+    return cena.seq->num_frames > 1;
+}
+
+#endif // CENA_H
@@ -0,0 +1,20 @@
+// Gerado por tools/digitos.c a partir de lib/font.h. Não editar.
+
+#include "digitos.h"
+
+const uint8_t digitos_oled[10][DIGITO_OLED_BYTES] = {
+	{0xfc, 0x0f, 0xfc, 0x0f, 0xff, 0x3f, 0xff, 0x3f, 0xc3, 0x33, 0xc3, 0x33, 0xf3, 0x30, 0xf3, 0x30, 0x3f, 0x30, 0x3f, 0x30, 0xff, 0x3f, 0xff, 0x3f, 0xfc, 0x0f, 0xfc, 0x0f, 0x00, 0x00, 0x00, 0x00}, // 0
+	{0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x30, 0x0c, 0x30, 0x0c, 0x30, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00}, // 1
+	{0x0c, 0x3f, 0x0c, 0x3f, 0xcf, 0x3f, 0xcf, 0x3f, 0xc3, 0x30, 0xc3, 0x30, 0xc3, 0x30, 0xc3, 0x30, 0xc3, 0x30, 0xc3, 0x30, 0xff, 0x30, 0xff, 0x30, 0x3c, 0x30, 0x3c, 0x30, 0x00, 0x00, 0x00, 0x00}, // 2
+	{0x03, 0x30, 0x03, 0x30, 0x03, 0x30, 0x03, 0x30, 0xc3, 0x30, 0xc3, 0x30, 0xc3, 0x30, 0xc3, 0x30, 0xc3, 0x30, 0xc3, 0x30, 0xff, 0x3f, 0xff, 0x3f, 0x3c, 0x0f, 0x3c, 0x0f, 0x00, 0x00, 0x00, 0x00}, // 3
+	{0xfc, 0x03, 0xfc, 0x03, 0xfc, 0x03, 0xfc, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0x00, 0x03, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00}, // 4
+	{0x3f, 0x0c, 0x3f, 0x0c, 0x3f, 0x3c, 0x3f, 0x3c, 0x33, 0x30, 0x33, 0x30, 0x33, 0x30, 0x33, 0x30, 0x33, 0x30, 0x33, 0x30, 0xf3, 0x3f, 0xf3, 0x3f, 0xc3, 0x0f, 0xc3, 0x0f, 0x00, 0x00, 0x00, 0x00}, // 5
+	{0xfc, 0x0f, 0xfc, 0x0f, 0xff, 0x3f, 0xff, 0x3f, 0xc3, 0x30, 0xc3, 0x30, 0xc3, 0x30, 0xc3, 0x30, 0xc3, 0x30, 0xc3, 0x30, 0xc3, 0x3f, 0xc3, 0x3f, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00}, // 6
+	{0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x3c, 0x03, 0x3c, 0x03, 0x3f, 0x03, 0x3f, 0xc3, 0x03, 0xc3, 0x03, 0xff, 0x00, 0xff, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00}, // 7
+	{0x3c, 0x0f, 0x3c, 0x0f, 0xff, 0x3f, 0xff, 0x3f, 0xc3, 0x30, 0xc3, 0x30, 0xc3, 0x30, 0xc3, 0x30, 0xc3, 0x30, 0xc3, 0x30, 0xff, 0x3f, 0xff, 0x3f, 0x3c, 0x0f, 0x3c, 0x0f, 0x00, 0x00, 0x00, 0x00}, // 8
+	{0x3c, 0x00, 0x3c, 0x00, 0xff, 0x30, 0xff, 0x30, 0xc3, 0x30, 0xc3, 0x30, 0xc3, 0x30, 0xc3, 0x30, 0xc3, 0x30, 0xc3, 0x30, 0xff, 0x3f, 0xff, 0x3f, 0xfc, 0x0f, 0xfc, 0x0f, 0x00, 0x00, 0x00, 0x00}, // 9
+};
+
+const uint16_t digitos_matriz[10] = {
+	0x7b6f, 0x2c97, 0x73e7, 0x73cf, 0x5bc9, 0x79cf, 0x79ef, 0x7292, 0x7bef, 0x7bcf,
+};
@@ -0,0 +1,20 @@
+#ifndef DIGITOS_H
+#define DIGITOS_H
+
+// Glifos pré-calculados dos dígitos da contagem regressiva (lib/digitos.c,
+// gerado por tools/digitos.c): cada atualização é uma cópia por dígito.
+
+#include <stdint.h>
+
+// OLED: 16x16, no layout de ssd1306_blit (colunas de 2 bytes, bit 0 em cima)
+#define DIGITO_OLED_LARGURA 16
+#define DIGITO_OLED_ALTURA 16
+#define DIGITO_OLED_BYTES (DIGITO_OLED_LARGURA * DIGITO_OLED_ALTURA / 8)
+extern const uint8_t digitos_oled[10][DIGITO_OLED_BYTES];
+
+// Matriz: 3x5, máscara de 15 bits linha a linha, bit 14 no canto superior esquerdo
+#define DIGITO_MATRIZ_LARGURA 3
+#define DIGITO_MATRIZ_ALTURA 5
+extern const uint16_t digitos_matriz[10];
+
+#endif // DIGITOS_H
@@ -0,0 +1,66 @@
+#include "energia.h"
+#include "FreeRTOS.h"
+#include "task.h"
+#include "hardware/timer.h"
+#include "hardware/sync.h"
+#include "hardware/structs/systick.h"
+
+static EnergiaContagem contagem;
+
+static int alarme = -1;
+// Fração de tick dormida que ainda não foi repassada ao kernel
+static uint32_t resto_us;
+
+// Só precisa existir: a interrupção do alarme basta para sair do WFI
+static void energia_alarme(uint alarm_num) {
+    (void)alarm_num;
+}
+
+void energia_init(void) {
+    alarme = hardware_alarm_claim_unused(true);
+    hardware_alarm_set_callback(alarme, energia_alarme);
+}
+
+EnergiaContagem energia_contagem(void) {
+    uint32_t irq = save_and_disable_interrupts();
+    EnergiaContagem c = contagem;
+    restore_interrupts(irq);
+    return c;
+}
+
+void energia_dormir(uint32_t ticks_esperados) {
+    if (alarme < 0)
+        return;
+
+    // Com as interrupções mascaradas o WFI ainda acorda, mas os handlers só
+    // rodam depois que o tick foi corrigido
+    uint32_t irq = save_and_disable_interrupts();
+    if (eTaskConfirmSleepModeStatus() == eAbortSleep) {
+        restore_interrupts(irq);
+        return;
+    }
+
+    systick_hw->csr &= ~M0PLUS_SYST_CSR_ENABLE_BITS;
+    uint64_t inicio = time_us_64();
+    // Acorda um tick antes do prazo; o último tick corre com o SysTick normal
+    uint64_t alvo = inicio + (uint64_t)(ticks_esperados - 1) * (1000000 / configTICK_RATE_HZ);
+    if (!hardware_alarm_set_target(alarme, from_us_since_boot(alvo))) {
+        __dsb();
+        __wfi();
+    }
+    hardware_alarm_cancel(alarme);
+
+    uint64_t dormido = time_us_64() - inicio;
+    resto_us += (uint32_t)dormido;
+    uint32_t ticks = resto_us / (1000000 / configTICK_RATE_HZ);
+    resto_us %= 1000000 / configTICK_RATE_HZ;
+    if (ticks > ticks_esperados)
+        ticks = ticks_esperados;
+    vTaskStepTick(ticks);
+
+    systick_hw->cvr = 0;
+    systick_hw->csr |= M0PLUS_SYST_CSR_ENABLE_BITS;
+    contagem.dormindo_us += dormido;
+    contagem.sonos++;
+    restore_interrupts(irq);
+}
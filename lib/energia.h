@@ -0,0 +1,25 @@
+#ifndef ENERGIA_H
+#define ENERGIA_H
+
+// Tickless idle do RP2040: quando todas as tarefas estão bloqueadas, a tarefa
+// idle para o SysTick e dorme (WFI) até o próximo prazo do kernel, acordada
+// por um alarme do timer ou por qualquer interrupção (botões, DMA).
+
+#include <stdint.h>
+
+// Instrumentação: tempo total dormindo e número de vezes que dormiu
+typedef struct {
+    uint64_t dormindo_us;
+    uint32_t sonos;
+} EnergiaContagem;
+
+void energia_init(void);
+
+// Totais desde o boot, lidos de uma vez (o sono os altera com as interrupções
+// mascaradas). No host, onde o kernel não dorme, ficam em zero.
+EnergiaContagem energia_contagem(void);
+
+// portSUPPRESS_TICKS_AND_SLEEP (FreeRTOSConfig.h)
+void energia_dormir(uint32_t ticks_esperados);
+
+#endif // ENERGIA_H
@@ -0,0 +1,62 @@
+#ifndef HAL_H
+#define HAL_H
+
+// Camada fina de acesso ao hardware. hal_pico.c implementa sobre o SDK do Pico;
+// host/hal_host.c implementa no Linux para o executável intellitraffic_host.
+
+#ifdef HAL_HOST
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+typedef unsigned int uint;
+typedef struct i2c_inst i2c_inst_t;
+static inline void tight_loop_contents(void) {}
+#else
+#include "pico/stdlib.h"
+#include "hardware/i2c.h"
+#endif
+
+void hal_init(void);
+
+// GPIO
+void hal_gpio_init_output(uint pin);
+void hal_gpio_init_input_pullup(uint pin);
+void hal_gpio_put(uint pin, bool value);
+bool hal_gpio_get(uint pin);
+// Chama callback na borda de descida do pino, em contexto de interrupção
+typedef void (*hal_gpio_irq_t)(uint pin);
+void hal_gpio_irq_falling(uint pin, hal_gpio_irq_t callback);
+// Pulso periódico por alarme do timer, sem a CPU: o pino fica alto e desce
+// por largura_us em cada múltiplo de periodo_ms do relógio (hal_micros); a
+// borda de descida marca o múltiplo
+void hal_gpio_pulso_periodico(uint pin, uint32_t periodo_ms, uint32_t largura_us);
+
+// PWM: onda quadrada de 50% no pino (buzzer)
+void hal_pwm_tone_start(uint pin, uint freq);
+void hal_pwm_tone_stop(uint pin);
+
+// Fitas de LEDs WS2812, uma por state machine do PIO, cada uma com seu canal
+// de DMA: fitas diferentes transmitem em paralelo. hal_led_strip_write inicia o
+// envio e retorna na hora; o buffer (GRB nos 24 bits altos de cada palavra)
+// não pode mudar até hal_led_strip_pronta, que inclui o reset que aplica o quadro.
+#define HAL_LED_STRIPS 4
+void hal_led_strip_init(uint strip, uint pin, float freq, bool rgbw);
+void hal_led_strip_write(uint strip, const uint32_t *pixels, size_t count);
+bool hal_led_strip_pronta(uint strip);
+
+// ADC em segundo plano: os canais 0..HAL_ADC_CANAIS-1 (GPIO 26, 27) são
+// amostrados em rodízio por DMA num buffer circular, sem interrupções.
+// hal_adc_media é a média das amostras recentes do canal (0..4095).
+#define HAL_ADC_CANAIS 2
+void hal_adc_init(uint amostras_por_segundo);
+uint16_t hal_adc_media(uint canal);
+
+// I2C: retorna a instância usada pelos transportes do display
+i2c_inst_t *hal_i2c_init(uint index, uint baudrate, uint sda, uint scl);
+
+// Relógio monotônico; hal_millis é hal_micros / 1000
+uint32_t hal_millis(void);
+uint64_t hal_micros(void);
+void hal_sleep_ms(uint32_t ms);
+
+#endif // HAL_H
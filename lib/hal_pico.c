@@ -0,0 +1,217 @@
+#include "hal.h"
+#include "energia.h"
+#include "hardware/gpio.h"
+#include "hardware/pwm.h"
+#include "hardware/pio.h"
+#include "hardware/dma.h"
+#include "hardware/adc.h"
+#include "ws2812.pio.h"
+
+// Fita n usa a state machine n do pio0
+#define LED_STRIP_PIO pio0
+
+// Tempo em nível baixo que o WS2812 usa para aplicar o quadro
+#define LED_STRIP_RESET_US 60
+
+static hal_gpio_irq_t gpio_callbacks[NUM_BANK0_GPIOS];
+
+typedef struct {
+    int dma;
+    uint32_t us_por_pixel;
+    volatile bool pronta;
+} LedStrip;
+
+static LedStrip led_strips[HAL_LED_STRIPS];
+static int led_strip_programa = -1;
+
+// Buffer circular do ADC: o DMA escreve com wrap de endereço, então precisa
+// estar alinhado ao próprio tamanho. Amostras intercaladas por canal.
+#define ADC_AMOSTRAS 64
+#define ADC_ANEL_BITS 7   // log2(ADC_AMOSTRAS * 2 bytes)
+static volatile uint16_t adc_anel[ADC_AMOSTRAS] __attribute__((aligned(ADC_AMOSTRAS * 2)));
+static uint32_t adc_contagem = ADC_AMOSTRAS;
+
+void hal_init(void) {
+    stdio_init_all();
+    energia_init();
+}
+
+void hal_gpio_init_output(uint pin) {
+    gpio_init(pin);
+    gpio_set_dir(pin, GPIO_OUT);
+}
+
+void hal_gpio_init_input_pullup(uint pin) {
+    gpio_init(pin);
+    gpio_set_dir(pin, GPIO_IN);
+    gpio_pull_up(pin);
+}
+
+void hal_gpio_put(uint pin, bool value) {
+    gpio_put(pin, value);
+}
+
+bool hal_gpio_get(uint pin) {
+    return gpio_get(pin);
+}
+
+// O SDK aceita um único callback de GPIO por núcleo; este repassa ao do pino
+static void hal_gpio_irq_dispatch(uint gpio, uint32_t events) {
+    (void)events;
+    if (gpio_callbacks[gpio])
+        gpio_callbacks[gpio](gpio);
+}
+
+void hal_gpio_irq_falling(uint pin, hal_gpio_irq_t callback) {
+    gpio_callbacks[pin] = callback;
+    gpio_set_irq_enabled_with_callback(pin, GPIO_IRQ_EDGE_FALL, true, hal_gpio_irq_dispatch);
+}
+
+typedef struct {
+    uint pino;
+    uint32_t periodo_us;
+    uint32_t largura_us;
+} PulsoPeriodico;
+
+static PulsoPeriodico pulso;
+
+// Retorno negativo: o próximo alarme conta do instante previsto deste, então
+// o atraso da interrupção não se acumula
+static int64_t pulso_alarme(alarm_id_t id, void *arg) {
+    (void)id;
+    PulsoPeriodico *p = arg;
+    bool alto = gpio_get_out_level(p->pino);
+    gpio_put(p->pino, !alto);
+    return -(int64_t)(alto ? p->largura_us : p->periodo_us - p->largura_us);
+}
+
+void hal_gpio_pulso_periodico(uint pin, uint32_t periodo_ms, uint32_t largura_us) {
+    pulso = (PulsoPeriodico){pin, periodo_ms * 1000, largura_us};
+    hal_gpio_init_output(pin);
+    gpio_put(pin, 1);
+    uint64_t periodo = pulso.periodo_us;
+    uint64_t proximo = (time_us_64() / periodo + 1) * periodo;
+    add_alarm_at(from_us_since_boot(proximo), pulso_alarme, &pulso, true);
+}
+
+void hal_pwm_tone_start(uint pin, uint freq) {
+    gpio_set_function(pin, GPIO_FUNC_PWM);
+    uint slice_num = pwm_gpio_to_slice_num(pin);
+    uint chan = pwm_gpio_to_channel(pin);
+    uint32_t clock = 125000000;
+    uint32_t divider = 100;
+    uint32_t wrap = clock / (divider * freq);
+    pwm_set_clkdiv(slice_num, divider);
+    pwm_set_wrap(slice_num, wrap);
+    pwm_set_chan_level(slice_num, chan, wrap / 2);
+    pwm_set_enabled(slice_num, true);
+}
+
+void hal_pwm_tone_stop(uint pin) {
+    uint slice_num = pwm_gpio_to_slice_num(pin);
+    pwm_set_enabled(slice_num, false);
+    gpio_set_function(pin, GPIO_FUNC_SIO);
+    gpio_put(pin, 0);
+}
+
+void hal_led_strip_init(uint strip, uint pin, float freq, bool rgbw) {
+    LedStrip *fita = &led_strips[strip];
+    if (led_strip_programa < 0)
+        led_strip_programa = pio_add_program(LED_STRIP_PIO, &ws2812_program);
+    pio_sm_claim(LED_STRIP_PIO, strip);
+    ws2812_program_init(LED_STRIP_PIO, strip, led_strip_programa, pin, freq, rgbw);
+    fita->us_por_pixel = (uint32_t)((rgbw ? 32 : 24) * 1000000.0f / freq) + 1;
+    fita->pronta = true;
+
+    // Palavras de 32 bits da memória para a FIFO do PIO, no ritmo do DREQ
+    fita->dma = dma_claim_unused_channel(true);
+    dma_channel_config c = dma_channel_get_default_config(fita->dma);
+    channel_config_set_transfer_data_size(&c, DMA_SIZE_32);
+    channel_config_set_read_increment(&c, true);
+    channel_config_set_write_increment(&c, false);
+    channel_config_set_dreq(&c, pio_get_dreq(LED_STRIP_PIO, strip, true));
+    dma_channel_configure(fita->dma, &c, &LED_STRIP_PIO->txf[strip], NULL, 0, false);
+}
+
+static int64_t led_strip_reset_concluido(alarm_id_t id, void *arg) {
+    (void)id;
+    ((LedStrip *)arg)->pronta = true;
+    return 0;
+}
+
+// O DMA termina antes do último bit sair da FIFO; o alarme cobre a
+// transmissão inteira mais o reset, sem a CPU esperar
+void hal_led_strip_write(uint strip, const uint32_t *pixels, size_t count) {
+    LedStrip *fita = &led_strips[strip];
+    fita->pronta = false;
+    dma_channel_transfer_from_buffer_now(fita->dma, pixels, count);
+    uint32_t duracao_us = count * fita->us_por_pixel + LED_STRIP_RESET_US;
+    if (add_alarm_in_us(duracao_us, led_strip_reset_concluido, fita, true) <= 0)
+        fita->pronta = true;
+}
+
+bool hal_led_strip_pronta(uint strip) {
+    return led_strips[strip].pronta;
+}
+
+// Um canal copia a FIFO do ADC para o anel; ao fim de cada volta ele dispara o
+// canal de controle, que recarrega a contagem do primeiro e o reinicia
+void hal_adc_init(uint amostras_por_segundo) {
+    adc_init();
+    for (uint canal = 0; canal < HAL_ADC_CANAIS; ++canal)
+        adc_gpio_init(26 + canal);
+    adc_select_input(0);
+    adc_set_round_robin((1u << HAL_ADC_CANAIS) - 1);
+    adc_fifo_setup(true, true, 1, false, false);
+    adc_set_clkdiv(48000000.0f / amostras_por_segundo - 1);
+
+    int dados = dma_claim_unused_channel(true);
+    int controle = dma_claim_unused_channel(true);
+
+    dma_channel_config c = dma_channel_get_default_config(dados);
+    channel_config_set_transfer_data_size(&c, DMA_SIZE_16);
+    channel_config_set_read_increment(&c, false);
+    channel_config_set_write_increment(&c, true);
+    channel_config_set_ring(&c, true, ADC_ANEL_BITS);
+    channel_config_set_dreq(&c, DREQ_ADC);
+    channel_config_set_chain_to(&c, controle);
+    dma_channel_configure(dados, &c, adc_anel, &adc_hw->fifo, ADC_AMOSTRAS, false);
+
+    c = dma_channel_get_default_config(controle);
+    channel_config_set_transfer_data_size(&c, DMA_SIZE_32);
+    channel_config_set_read_increment(&c, false);
+    channel_config_set_write_increment(&c, false);
+    dma_channel_configure(controle, &c, &dma_hw->ch[dados].al1_transfer_count_trig, &adc_contagem, 1, false);
+
+    dma_channel_start(dados);
+    adc_run(true);
+}
+
+uint16_t hal_adc_media(uint canal) {
+    uint32_t soma = 0;
+    for (uint i = canal; i < ADC_AMOSTRAS; i += HAL_ADC_CANAIS)
+        soma += adc_anel[i];
+    return soma / (ADC_AMOSTRAS / HAL_ADC_CANAIS);
+}
+
+i2c_inst_t *hal_i2c_init(uint index, uint baudrate, uint sda, uint scl) {
+    i2c_inst_t *i2c = index ? i2c1 : i2c0;
+    i2c_init(i2c, baudrate);
+    gpio_set_function(sda, GPIO_FUNC_I2C);
+    gpio_set_function(scl, GPIO_FUNC_I2C);
+    gpio_pull_up(sda);
+    gpio_pull_up(scl);
+    return i2c;
+}
+
+uint32_t hal_millis(void) {
+    return to_ms_since_boot(get_absolute_time());
+}
+
+uint64_t hal_micros(void) {
+    return time_us_64();
+}
+
+void hal_sleep_ms(uint32_t ms) {
+    sleep_ms(ms);
+}
@@ -0,0 +1,116 @@
+#include "matriz.h"
+#include <string.h>
+
+// Nível baixo que o WS2812 usa para aplicar o quadro (ver hal_led_strip_write)
+#define RESET_US 60
+
+static void montar_lut(Matriz *m) {
+    for (uint i = 0; i < 256; ++i)
+        m->lut[i] = (matriz_gama[i] * m->brilho + 127) / 255;
+}
+
+bool matriz_init(Matriz *m, const MatrizPainel *paineis, uint num_paineis, uint8_t brilho) {
+    memset(m, 0, sizeof(*m));
+    m->brilho = brilho;
+    montar_lut(m);
+
+    // Tamanho de cada cadeia: até o último LED do painel mais distante
+    for (uint p = 0; p < num_paineis; ++p) {
+        const MatrizPainel *painel = &paineis[p];
+        if (painel->cadeia >= MATRIZ_MAX_CADEIAS || painel->x + painel->largura > MATRIZ_LARGURA ||
+            painel->y + painel->altura > MATRIZ_ALTURA)
+            return false;
+        uint fim = painel->inicio + painel->largura * painel->altura;
+        if (fim > m->cadeia_tamanho[painel->cadeia])
+            m->cadeia_tamanho[painel->cadeia] = fim;
+        if (painel->cadeia + 1u > m->num_cadeias)
+            m->num_cadeias = painel->cadeia + 1;
+    }
+    uint total = 0;
+    for (uint c = 0; c < m->num_cadeias; ++c) {
+        m->cadeia_inicio[c] = total;
+        total += m->cadeia_tamanho[c];
+    }
+    if (total > MATRIZ_PIXELS)
+        return false;
+
+    // LEDs sem painel (buracos na cadeia) apontam para o pixel extra, apagado
+    for (uint led = 0; led < MATRIZ_PIXELS; ++led)
+        m->origem[led] = MATRIZ_PIXELS;
+    for (uint p = 0; p < num_paineis; ++p) {
+        const MatrizPainel *painel = &paineis[p];
+        uint led = m->cadeia_inicio[painel->cadeia] + painel->inicio;
+        for (uint linha = 0; linha < painel->altura; ++linha) {
+            for (uint i = 0; i < painel->largura; ++i, ++led) {
+                uint coluna = painel->serpentina && (linha & 1) ? painel->largura - 1 - i : i;
+                m->origem[led] = (painel->y + linha) * MATRIZ_LARGURA + painel->x + coluna;
+            }
+        }
+    }
+    return true;
+}
+
+void matriz_brilho(Matriz *m, uint8_t brilho) {
+    if (brilho == m->brilho)
+        return;
+    m->brilho = brilho;
+    montar_lut(m);
+}
+
+void matriz_preencher(Matriz *m, uint32_t cor) {
+    for (uint i = 0; i < MATRIZ_PIXELS; ++i)
+        m->quadro[i] = cor;
+}
+
+void matriz_pixel(Matriz *m, uint x, uint y, uint32_t cor) {
+    if (x >= MATRIZ_LARGURA || y >= MATRIZ_ALTURA)
+        return;
+    m->quadro[y * MATRIZ_LARGURA + x] = cor;
+}
+
+// Único lugar que conhece a ordem dos canais no fio
+static inline uint32_t converter(const uint8_t *lut, uint32_t c) {
+    return ((uint32_t)lut[(c >> 8) & 0xFF] << 24) |
+           ((uint32_t)lut[(c >> 16) & 0xFF] << 16) |
+           ((uint32_t)lut[c & 0xFF] << 8);
+}
+
+bool matriz_mostrar(Matriz *m) {
+    // enviado é reescrito no lugar: nenhuma cadeia pode estar lendo dele
+    for (uint c = 0; c < m->num_cadeias; ++c) {
+        if (m->cadeia_tamanho[c] && !hal_led_strip_pronta(c))
+            return false;
+    }
+
+    // Uma passada: converte na ordem dos LEDs e marca as cadeias alteradas
+    bool alguma = false;
+    for (uint c = 0; c < m->num_cadeias; ++c) {
+        uint32_t *saida = &m->enviado[m->cadeia_inicio[c]];
+        const uint16_t *origem = &m->origem[m->cadeia_inicio[c]];
+        bool mudou = !m->enviado_valido;
+        for (uint i = 0; i < m->cadeia_tamanho[c]; ++i) {
+            uint32_t valor = converter(m->lut, m->quadro[origem[i]]);
+            mudou |= valor != saida[i];
+            saida[i] = valor;
+        }
+        if (mudou && m->cadeia_tamanho[c]) {
+            hal_led_strip_write(c, saida, m->cadeia_tamanho[c]);
+            alguma = true;
+        }
+    }
+    m->enviado_valido = true;
+    if (alguma)
+        m->quadros_enviados++;
+    else
+        m->quadros_iguais++;
+    return true;
+}
+
+uint32_t matriz_tempo_quadro_us(const Matriz *m, float freq, bool rgbw) {
+    uint maior = 0;
+    for (uint c = 0; c < m->num_cadeias; ++c) {
+        if (m->cadeia_tamanho[c] > maior)
+            maior = m->cadeia_tamanho[c];
+    }
+    return (uint32_t)(maior * (rgbw ? 32 : 24) * 1000000.0f / freq) + RESET_US;
+}
@@ -0,0 +1,75 @@
+#ifndef MATRIZ_H
+#define MATRIZ_H
+
+// Matriz de LEDs WS2812 formada por um ou mais painéis. O quadro é desenhado
+// pixel a pixel em cores RGB por coordenada; matriz_mostrar o converte (gama e
+// brilho) para a ordem física dos LEDs e entrega à HAL cada cadeia (fita) que
+// mudou. Cadeias diferentes são transmitidas em paralelo por DMA.
+
+#include "hal.h"
+
+// Tamanho da área de desenho; a placa tem um único painel 5x5. Os painéis
+// descritos em MatrizPainel cobrem essa área.
+#ifndef MATRIZ_LARGURA
+#define MATRIZ_LARGURA 5
+#endif
+#ifndef MATRIZ_ALTURA
+#define MATRIZ_ALTURA 5
+#endif
+#define MATRIZ_PIXELS (MATRIZ_LARGURA * MATRIZ_ALTURA)
+#define MATRIZ_MAX_CADEIAS HAL_LED_STRIPS
+
+// Curva gama por canal (lib/matriz_gama.c, gerada por tools/matriz_gama.c)
+extern const uint8_t matriz_gama[256];
+
+// Um painel retangular ligado a uma cadeia. Os LEDs seguem linha a linha a
+// partir do canto superior esquerdo; em serpentina as linhas ímpares vão da
+// direita para a esquerda.
+typedef struct {
+    uint8_t cadeia;
+    uint16_t inicio;        // posição do primeiro LED do painel na cadeia
+    uint16_t x, y;          // canto superior esquerdo na área de desenho
+    uint16_t largura, altura;
+    bool serpentina;
+} MatrizPainel;
+
+typedef struct {
+    uint32_t quadro[MATRIZ_PIXELS + 1]; // em desenho, RGB, por coordenada; o último fica apagado
+    uint32_t enviado[MATRIZ_PIXELS];    // cadeias em sequência, na ordem dos LEDs; origem do DMA
+    uint16_t origem[MATRIZ_PIXELS];     // pixel do quadro de cada LED de enviado
+    uint16_t cadeia_inicio[MATRIZ_MAX_CADEIAS];
+    uint16_t cadeia_tamanho[MATRIZ_MAX_CADEIAS];
+    uint num_cadeias;
+    uint8_t brilho;
+    bool enviado_valido;
+    uint8_t lut[256];                   // gama já escalado pelo brilho
+    uint32_t quadros_enviados;
+    uint32_t quadros_iguais;
+} Matriz;
+
+// Cor lógica, antes de gama e brilho
+static inline uint32_t matriz_rgb(uint8_t r, uint8_t g, uint8_t b) {
+    return ((uint32_t)r << 16) | ((uint32_t)g << 8) | b;
+}
+
+// Monta o mapa coordenada -> LED a partir dos painéis. Retorna false se algum
+// painel sai da área de desenho, da cadeia ou se as cadeias não cabem no quadro.
+bool matriz_init(Matriz *m, const MatrizPainel *paineis, uint num_paineis, uint8_t brilho);
+
+// Brilho global (0-255): limita a intensidade de saída de todos os canais.
+// Refaz a tabela só quando o valor muda.
+void matriz_brilho(Matriz *m, uint8_t brilho);
+
+void matriz_preencher(Matriz *m, uint32_t cor);
+void matriz_pixel(Matriz *m, uint x, uint y, uint32_t cor);
+
+// Converte o quadro e envia as cadeias em que algum LED mudou. Retorna false
+// se alguma cadeia ainda está transmitindo o quadro anterior; o quadro fica
+// guardado e deve ser mostrado de novo.
+bool matriz_mostrar(Matriz *m);
+
+// Modelo de tempo: duração de um quadro completo (bits de todos os LEDs da
+// cadeia mais longa e o reset), já que as cadeias transmitem em paralelo
+uint32_t matriz_tempo_quadro_us(const Matriz *m, float freq, bool rgbw);
+
+#endif // MATRIZ_H
@@ -0,0 +1,346 @@
+#include "semaforo.h"
+
+// Tabela dos planos. Fora de pico é o ciclo original; no pico o verde da via
+// principal dura mais. No atuado cada verde fica entre 3 e 10 s conforme as
+// filas. O coordenado usa os tempos de COORDENADO_* (ou os carregados por
+// semaforo_coordenar). No noturno o amarelo pisca a cada segundo e o beep
+// acompanha cada apagada (um a cada 2 s).
+const PlanoTempo planos[NUM_PLANOS] = {
+    [PLANO_FORA_PICO] = {
+        .nome = "fora de pico",
+        .num_fases = 3,
+        .fases = {
+            {ESTADO_VERDE, 5000, .verde = true, .sinal = true, .bipe = {2000, 100, 900, true}},
+            {ESTADO_AMARELO, 2000, .amarelo = true, .bipe = {3000, 100, 100, true}},
+            {ESTADO_VERMELHO, 5000, .vermelho = true, .sinal = true, .bipe = {1000, 500, 1500, false}},
+        },
+    },
+    [PLANO_PICO] = {
+        .nome = "pico",
+        .num_fases = 3,
+        .fases = {
+            {ESTADO_VERDE, 8000, .verde = true, .sinal = true, .bipe = {2000, 100, 900, true}},
+            {ESTADO_AMARELO, 2000, .amarelo = true, .bipe = {3000, 100, 100, true}},
+            {ESTADO_VERMELHO, 4000, .vermelho = true, .sinal = true, .bipe = {1000, 500, 1500, false}},
+        },
+    },
+    [PLANO_ATUADO] = {
+        .nome = "atuado",
+        .num_fases = 3,
+        .fases = {
+            {ESTADO_VERDE, 10000, .verde = true, .sinal = true, .bipe = {2000, 100, 900, true},
+             .atuada = true, .minimo = 3000, .sensor = SENSOR_VIA, .oposto = SENSOR_TRANSVERSAL},
+            {ESTADO_AMARELO, 2000, .amarelo = true, .bipe = {3000, 100, 100, true}},
+            {ESTADO_VERMELHO, 10000, .vermelho = true, .sinal = true, .bipe = {1000, 500, 1500, false},
+             .atuada = true, .minimo = 3000, .sensor = SENSOR_TRANSVERSAL, .oposto = SENSOR_VIA},
+        },
+    },
+    [PLANO_COORDENADO] = {
+        .nome = "coordenado",
+        .coordenado = true,
+        .num_fases = 3,
+        .fases = {
+            {ESTADO_VERDE, COORDENADO_VERDE, .verde = true, .sinal = true, .bipe = {2000, 100, 900, true},
+             .minimo = COORDENADO_VERDE_MINIMO},
+            {ESTADO_AMARELO, COORDENADO_AMARELO, .amarelo = true, .bipe = {3000, 100, 100, true}},
+            {ESTADO_VERMELHO, COORDENADO_VERMELHO, .vermelho = true, .sinal = true, .bipe = {1000, 500, 1500, false}},
+        },
+    },
+    [PLANO_NOTURNO] = {
+        .nome = "noturno",
+        .noturno = true,
+        .num_fases = 2,
+        .fases = {
+            {ESTADO_AMARELO, 1000, .bipe = {1500, 100, 1900, true}},
+            {ESTADO_AMARELO, 1000, .amarelo = true},
+        },
+    },
+};
+
+// Uma instância durante um passo: o estado de trabalho e para onde vão as saídas
+typedef struct {
+    SemaforoEstado *e;
+    const SaidasSemaforo *saidas;
+    uint id;
+} Instancia;
+
+static void iniciar_buzzer(const Instancia *in, uint freq) {
+    in->saidas->buzzer(in->saidas->ctx, in->id, freq);
+    in->e->buzzer = true;
+}
+
+static void parar_buzzer(const Instancia *in) {
+    in->saidas->buzzer(in->saidas->ctx, in->id, 0);
+    in->e->buzzer = false;
+}
+
+static void iniciar_exibicao_sinal(SemaforoEstado *e, uint32_t agora) {
+    e->tempo_inicio_sinal = agora;
+    e->exibindo_sinal = true;
+}
+
+// Tempo restante até inicio + duracao (0 se já passou); a subtração sem sinal
+// continua correta quando o contador de ms dá a volta
+static uint32_t restante(uint32_t agora, uint32_t inicio, uint32_t duracao) {
+    uint32_t decorrido = agora - inicio;
+    return decorrido >= duracao ? 0 : duracao - decorrido;
+}
+
+static uint32_t menor(uint32_t a, uint32_t b) {
+    return a < b ? a : b;
+}
+
+static const PlanoTempo *plano_de(const SemaforoEstado *e, PlanoId plano) {
+    return plano == PLANO_COORDENADO && e->coordenado ? e->coordenado : &planos[plano];
+}
+
+static const FasePlano *fase_atual(const SemaforoEstado *e) {
+    return &plano_de(e, e->plano)->fases[e->fase];
+}
+
+// Duração da fase atual com o ajuste de coordenação
+static uint32_t duracao_fase(const SemaforoEstado *e, const FasePlano *f) {
+    return f->duracao + e->ajuste;
+}
+
+// Até onde a contagem regressiva vai. Uma fase atuada pode acabar em qualquer
+// leitura dos sensores depois do mínimo: conta só até o mínimo e some depois,
+// em vez de contar até o máximo e pular para 0 quando a fila esvazia.
+static uint32_t horizonte_contagem(const SemaforoEstado *e, const FasePlano *f) {
+    return f->atuada ? f->minimo : duracao_fase(e, f);
+}
+
+// Na entrada do ciclo de um plano coordenado: quanto a primeira fase muda para
+// que o próximo ciclo comece na defasagem. Um atraso pequeno encurta a fase
+// (até o mínimo; o resto fica para o ciclo seguinte), um grande a alonga até
+// o início seguinte.
+static int32_t ajuste_coordenado(const SemaforoEstado *e, const PlanoTempo *p, uint32_t agora) {
+    uint32_t ciclo = 0;
+    for (int i = 0; i < p->num_fases; ++i)
+        ciclo += p->fases[i].duracao;
+    uint32_t atraso = (agora - e->defasagem) % ciclo;
+    if (atraso == 0)
+        return 0;
+    if (atraso <= ciclo / 2) {
+        const FasePlano *f = &p->fases[0];
+        uint32_t folga = f->duracao > f->minimo ? f->duracao - f->minimo : 0;
+        return -(int32_t)menor(atraso, folga);
+    }
+    return ciclo - atraso;
+}
+
+static void entrar_fase(const Instancia *in, PlanoId plano, uint8_t fase, uint32_t agora) {
+    SemaforoEstado *e = in->e;
+    const FasePlano *anterior = e->iniciado ? fase_atual(e) : NULL;
+    const PlanoTempo *p = plano_de(e, plano);
+    e->plano = plano;
+    e->fase = fase;
+    e->modo_noturno = p->noturno;
+    const FasePlano *f = fase_atual(e);
+    e->estado = f->indicacao;
+    e->tempo_ultimo_estado = agora;
+    e->ajuste = fase == 0 && p->coordenado ? ajuste_coordenado(e, p, agora) : 0;
+
+    // Apaga antes de acender, e só o que muda
+    bool antes[NUM_LUZES] = {anterior && anterior->vermelho, anterior && anterior->amarelo, anterior && anterior->verde};
+    bool depois[NUM_LUZES] = {f->vermelho, f->amarelo, f->verde};
+    for (int i = 0; i < NUM_LUZES; ++i)
+        if (!e->iniciado || (antes[i] && !depois[i]))
+            in->saidas->luz(in->saidas->ctx, in->id, i, false);
+    for (int i = 0; i < NUM_LUZES; ++i)
+        if (depois[i] && !antes[i])
+            in->saidas->luz(in->saidas->ctx, in->id, i, true);
+
+    if (e->buzzer)
+        parar_buzzer(in);
+    if (f->bipe.freq && f->bipe.comeca_ligado)
+        iniciar_buzzer(in, f->bipe.freq);
+    e->tempo_ultimo_beep = agora;
+
+    if (f->sinal)
+        iniciar_exibicao_sinal(e, agora);
+    e->iniciado = true;
+}
+
+// Fim do ciclo (ou primeira passada): é aqui que um pedido de plano vale
+static PlanoId proximo_plano(SemaforoEstado *e) {
+    int pedido = e->plano_pedido;
+    e->plano_pedido = -1;
+    if (pedido < 0)
+        return e->iniciado ? e->plano : e->plano_diurno;
+    if (!plano_de(e, pedido)->noturno)
+        e->plano_diurno = pedido;
+    return pedido;
+}
+
+// Fase atuada depois do mínimo: a fila atendida esvaziou e a outra espera
+static bool fila_atendida(const Instancia *in, const FasePlano *f, uint32_t decorrido) {
+    const SaidasSemaforo *o = in->saidas;
+    return f->atuada && decorrido >= f->minimo && o->sensor &&
+           o->sensor(o->ctx, in->id, f->sensor) < LIMIAR_FILA_VAZIA &&
+           o->sensor(o->ctx, in->id, f->oposto) >= LIMIAR_FILA_VAZIA;
+}
+
+static uint32_t avancar(const Instancia *in, uint32_t agora) {
+    SemaforoEstado *e = in->e;
+    if (!e->iniciado)
+        entrar_fase(in, proximo_plano(e), 0, agora);
+
+    const FasePlano *f = fase_atual(e);
+    uint32_t decorrido = agora - e->tempo_ultimo_estado;
+    if (decorrido >= duracao_fase(e, f) || fila_atendida(in, f, decorrido)) {
+        uint8_t proxima = e->fase + 1;
+        if (proxima < plano_de(e, e->plano)->num_fases)
+            entrar_fase(in, e->plano, proxima, agora);
+        else
+            entrar_fase(in, proximo_plano(e), 0, agora);
+        f = fase_atual(e);
+    }
+    uint32_t duracao = duracao_fase(e, f);
+
+    uint32_t prazo = restante(agora, e->tempo_ultimo_estado, duracao);
+    if (f->atuada) {
+        // Até o mínimo nada é lido; depois os sensores são conferidos a cada
+        // PERIODO_SENSOR
+        uint32_t minimo = restante(agora, e->tempo_ultimo_estado, f->minimo);
+        prazo = menor(prazo, minimo ? minimo : PERIODO_SENSOR);
+    }
+    if (f->bipe.freq) {
+        uint32_t bipe = e->buzzer ? f->bipe.ligado : f->bipe.desligado;
+        if (agora - e->tempo_ultimo_beep >= bipe) {
+            if (e->buzzer) parar_buzzer(in);
+            else iniciar_buzzer(in, f->bipe.freq);
+            e->tempo_ultimo_beep = agora;
+            bipe = e->buzzer ? f->bipe.ligado : f->bipe.desligado;
+        }
+        prazo = menor(prazo, restante(agora, e->tempo_ultimo_beep, bipe));
+    }
+
+    // A contagem regressiva muda a cada segundo cheio antes do fim da fase
+    if (e->modo_noturno) {
+        e->contagem = 0;
+    } else {
+        uint32_t fase = restante(agora, e->tempo_ultimo_estado, horizonte_contagem(e, f));
+        e->contagem = (fase + 999) / 1000;
+        if (e->contagem > 1)
+            prazo = menor(prazo, fase - (e->contagem - 1) * 1000);
+    }
+
+    // O fim da exibição do sinal também é um prazo, para que os leitores não
+    // precisem do relógio
+    if (e->exibindo_sinal) {
+        uint32_t prazo_sinal = restante(agora, e->tempo_inicio_sinal, TEMPO_EXIBICAO_SINAL);
+        if (prazo_sinal == 0)
+            e->exibindo_sinal = false;
+        else
+            prazo = menor(prazo, prazo_sinal);
+    }
+    return prazo;
+}
+
+static void alternar(const Instancia *in, uint32_t agora) {
+    SemaforoEstado *e = in->e;
+    // Um pedido pendente para o modo de destino é atendido já
+    bool para_noturno = !e->modo_noturno;
+    if (e->plano_pedido >= 0 && plano_de(e, e->plano_pedido)->noturno == para_noturno)
+        proximo_plano(e);
+
+    e->exibindo_sinal = false;
+    entrar_fase(in, para_noturno ? PLANO_NOTURNO : e->plano_diurno, 0, agora);
+    e->contagem = para_noturno ? 0 : (horizonte_contagem(e, fase_atual(e)) + 999) / 1000;
+}
+
+static void iniciar_estado(SemaforoEstado *e) {
+    *e = (SemaforoEstado){.plano_diurno = PLANO_FORA_PICO, .plano_pedido = -1};
+}
+
+void semaforo_init(Semaforo *s, const SaidasSemaforo *saidas, uint id) {
+    iniciar_estado(&s->atual);
+    s->publicado = s->atual;
+    s->saidas = *saidas;
+    s->id = id;
+    atomic_init(&s->pedido, -1);
+    atomic_init(&s->sequencia, 0);
+}
+
+static void publicar(Semaforo *s) {
+    unsigned seq = atomic_load_explicit(&s->sequencia, memory_order_relaxed);
+    atomic_store_explicit(&s->sequencia, seq + 1, memory_order_relaxed);
+    atomic_thread_fence(memory_order_release);
+    s->publicado = s->atual;
+    atomic_store_explicit(&s->sequencia, seq + 2, memory_order_release);
+}
+
+void semaforo_ler(Semaforo *s, SemaforoEstado *copia) {
+    unsigned seq;
+    do {
+        seq = atomic_load_explicit(&s->sequencia, memory_order_acquire);
+        *copia = s->publicado;
+        atomic_thread_fence(memory_order_acquire);
+    } while ((seq & 1) || seq != atomic_load_explicit(&s->sequencia, memory_order_relaxed));
+}
+
+// Traz para o estado de trabalho o pedido feito por outra tarefa
+static void receber_pedido(Semaforo *s) {
+    int pedido = atomic_exchange(&s->pedido, -1);
+    if (pedido >= 0)
+        s->atual.plano_pedido = pedido;
+}
+
+uint32_t semaforo_passo(Semaforo *s, uint32_t agora) {
+    receber_pedido(s);
+    Instancia in = {&s->atual, &s->saidas, s->id};
+    uint32_t prazo = avancar(&in, agora);
+    publicar(s);
+    return prazo;
+}
+
+void semaforo_alternar_modo(Semaforo *s, uint32_t agora) {
+    receber_pedido(s);
+    Instancia in = {&s->atual, &s->saidas, s->id};
+    alternar(&in, agora);
+    publicar(s);
+}
+
+void semaforo_coordenar(Semaforo *s, const PlanoTempo *plano, uint32_t defasagem) {
+    s->atual.coordenado = plano;
+    s->atual.defasagem = defasagem;
+}
+
+void semaforo_selecionar_plano(Semaforo *s, PlanoId plano) {
+    if (plano < NUM_PLANOS)
+        atomic_store(&s->pedido, plano);
+}
+
+void semaforo_lote_init(SemaforoLote *l, SemaforoEstado *estados, uint32_t *prazos, uint n,
+                        const SaidasSemaforo *saidas, PlanoId plano, uint32_t agora) {
+    l->n = n;
+    l->estados = estados;
+    l->prazos = prazos;
+    l->saidas = *saidas;
+    l->passos = 0;
+    for (uint i = 0; i < n; ++i) {
+        iniciar_estado(&estados[i]);
+        estados[i].plano_pedido = plano;
+        prazos[i] = agora;
+    }
+}
+
+uint32_t semaforo_lote_passo(SemaforoLote *l, uint32_t agora) {
+    uint32_t espera = UINT32_MAX;
+    for (uint i = 0; i < l->n; ++i) {
+        uint32_t falta = l->prazos[i] - agora;
+        if ((int32_t)falta > 0) {
+            espera = menor(espera, falta);
+            continue;
+        }
+        Instancia in = {&l->estados[i], &l->saidas, i};
+        uint32_t prazo = avancar(&in, agora);
+        if (prazo == 0)
+            prazo = 1;
+        l->prazos[i] = agora + prazo;
+        espera = menor(espera, prazo);
+        l->passos++;
+    }
+    return espera;
+}
@@ -0,0 +1,191 @@
+#ifndef SEMAFORO_H
+#define SEMAFORO_H
+
+// Máquina de estados do semáforo (ciclo normal e modo noturno), separada das
+// tarefas do FreeRTOS: recebe o instante atual como parâmetro e age sobre as
+// saídas por funções injetadas, de modo que roda igual no firmware, no
+// simulador do host e em quantas instâncias (cruzamentos) forem precisas.
+
+#include "hal.h"
+#include <stdatomic.h>
+
+typedef enum {
+    ESTADO_VERDE,
+    ESTADO_AMARELO,
+    ESTADO_VERMELHO
+} EstadoSemaforo;
+
+#define TEMPO_ATUALIZACAO_DISPLAY 500
+#define TEMPO_ATUALIZACAO_MATRIZ 100
+// No modo noturno o display apaga após este tempo sem toque nos botões
+#define TEMPO_DISPLAY_NOTURNO 30000
+#define TEMPO_EXIBICAO_SINAL 2000
+
+// Planos de tempo (tabela em semaforo.c). O noturno é o amarelo piscante; o
+// atuado ajusta os verdes pela fila medida nos potenciômetros; o coordenado
+// tem ciclo fixo começando sempre na defasagem do cruzamento (onda verde).
+typedef enum {
+    PLANO_FORA_PICO,
+    PLANO_PICO,
+    PLANO_ATUADO,
+    PLANO_COORDENADO,
+    PLANO_NOTURNO,
+    NUM_PLANOS
+} PlanoId;
+
+// Buzzer de uma fase: alterna ligado/desligado pelos tempos dados, começando
+// na entrada da fase; freq 0 deixa o buzzer mudo
+typedef struct {
+    uint16_t freq;
+    uint16_t ligado;
+    uint16_t desligado;
+    bool comeca_ligado;
+} BipeFase;
+
+// Sensores de fila (canais do ADC): a via do semáforo, atendida no verde, e a
+// transversal, atendida enquanto ele está vermelho
+#define SENSOR_VIA 0
+#define SENSOR_TRANSVERSAL 1
+// Abaixo disto (média do ADC) a fila é considerada vazia
+#define LIMIAR_FILA_VAZIA 400
+// Intervalo entre leituras dos sensores depois do tempo mínimo de uma fase atuada
+#define PERIODO_SENSOR 250
+
+typedef struct {
+    EstadoSemaforo indicacao;    // o que o display e a matriz mostram
+    uint16_t duracao;            // nas fases atuadas, o máximo
+    bool vermelho, amarelo, verde;
+    bool sinal;                  // mostra o sinal de pedestre ao entrar
+    BipeFase bipe;
+    // Fase atuada: depois de minimo, termina assim que a fila do sensor
+    // esvazia e há fila no sensor oposto
+    bool atuada;
+    uint16_t minimo;
+    uint8_t sensor, oposto;
+} FasePlano;
+
+#define MAX_FASES_PLANO 4
+
+// Tempos do plano coordenado da tabela; tools/onda_verde.c calcula os de um
+// corredor e imprime as definições para a compilação de cada placa
+#ifndef COORDENADO_VERDE
+#define COORDENADO_VERDE 6000
+#endif
+#ifndef COORDENADO_AMARELO
+#define COORDENADO_AMARELO 2000
+#endif
+#ifndef COORDENADO_VERMELHO
+#define COORDENADO_VERMELHO 6000
+#endif
+// Piso do verde quando ele é encurtado para alcançar a defasagem
+#ifndef COORDENADO_VERDE_MINIMO
+#define COORDENADO_VERDE_MINIMO 3000
+#endif
+
+typedef struct {
+    const char *nome;
+    bool noturno;
+    // Os ciclos começam em defasagem + k * ciclo; a primeira fase absorve a
+    // diferença, sem ficar abaixo do seu minimo
+    bool coordenado;
+    uint8_t num_fases;
+    FasePlano fases[MAX_FASES_PLANO];
+} PlanoTempo;
+
+extern const PlanoTempo planos[NUM_PLANOS];
+
+// Estado completo de um controlador. A tarefa do semáforo é a única que
+// escreve; as demais leem cópias consistentes com semaforo_ler.
+typedef struct {
+    bool modo_noturno;
+    EstadoSemaforo estado;
+    PlanoId plano;
+    uint8_t fase;
+    uint32_t tempo_ultimo_estado;   // início da fase
+    uint32_t tempo_ultimo_beep;     // última troca do buzzer
+    uint32_t tempo_inicio_sinal;
+    bool buzzer;
+    bool exibindo_sinal;     // imagem do sinal de pedestre na tela
+    uint8_t contagem;        // segundos até o fim da fase (nas atuadas, até o mínimo), arredondado para
+                             // cima; 0 no modo noturno e depois do mínimo das atuadas
+    bool iniciado;
+    PlanoId plano_diurno;    // para onde o botão A volta
+    int8_t plano_pedido;     // troca pendente para o fim do ciclo (-1: nenhuma)
+    const PlanoTempo *coordenado;   // tempos do plano coordenado (NULL: os da tabela)
+    uint32_t defasagem;      // início de ciclo do plano coordenado, em ms do relógio
+    int32_t ajuste;          // ms somados à fase atual para alcançar a defasagem
+} SemaforoEstado;
+
+typedef enum {
+    LUZ_VERMELHA,
+    LUZ_AMARELA,
+    LUZ_VERDE,
+    NUM_LUZES
+} Luz;
+
+// Saídas e sensores de um controlador. id identifica a instância, para que
+// um mesmo conjunto de funções atenda vários cruzamentos.
+typedef struct {
+    void (*luz)(void *ctx, uint id, Luz luz, bool acesa);
+    void (*buzzer)(void *ctx, uint id, uint freq);      // freq 0 desliga
+    uint16_t (*sensor)(void *ctx, uint id, uint canal); // média do ADC; NULL: sem sensores
+    void *ctx;
+} SaidasSemaforo;
+
+// Um cruzamento com a cópia publicada para outras tarefas
+typedef struct {
+    SemaforoEstado atual;           // só a tarefa do semáforo acessa
+    SaidasSemaforo saidas;
+    uint id;
+    atomic_int pedido;              // semaforo_selecionar_plano, de qualquer tarefa
+    // Seqlock: a sequência fica ímpar durante a escrita e o leitor repete a
+    // cópia se ela mudou no meio
+    atomic_uint sequencia;
+    SemaforoEstado publicado;
+} Semaforo;
+
+void semaforo_init(Semaforo *s, const SaidasSemaforo *saidas, uint id);
+
+// Avança a máquina até o instante agora. Retorna quantos ms faltam para o
+// próximo prazo (fim de fase, troca do buzzer, troca do segundo da contagem);
+// antes disso nada muda.
+uint32_t semaforo_passo(Semaforo *s, uint32_t agora);
+
+// Botão A: alterna na hora entre o plano diurno e o noturno
+void semaforo_alternar_modo(Semaforo *s, uint32_t agora);
+
+// Pede a troca de plano, aplicada no fim do ciclo atual (ou no primeiro passo).
+// Pode ser chamada de qualquer tarefa.
+void semaforo_selecionar_plano(Semaforo *s, PlanoId plano);
+
+// Tempos e defasagem do plano coordenado deste cruzamento (plano NULL: os da
+// tabela). Só antes do primeiro passo ou na própria tarefa do semáforo; o
+// plano passado precisa continuar existindo.
+void semaforo_coordenar(Semaforo *s, const PlanoTempo *plano, uint32_t defasagem);
+
+// Copia o último estado publicado, sem bloquear; pode ser chamada de qualquer
+// tarefa ou núcleo
+void semaforo_ler(Semaforo *s, SemaforoEstado *copia);
+
+// Lote de cruzamentos avançados juntos por um único laço, sem publicação. Os
+// prazos ficam num vetor à parte dos estados: a varredura que procura as
+// instâncias vencidas lê 4 bytes por cruzamento e só toca o estado das que
+// avançam. Os vetores são do chamador.
+typedef struct {
+    uint n;
+    SemaforoEstado *estados;
+    uint32_t *prazos;       // instante do próximo passo de cada instância
+    SaidasSemaforo saidas;  // id é o índice no lote
+    uint64_t passos;
+} SemaforoLote;
+
+// Todas as instâncias começam no plano dado com o primeiro passo em agora;
+// quem monta o lote pode escalonar os prazos iniciais
+void semaforo_lote_init(SemaforoLote *l, SemaforoEstado *estados, uint32_t *prazos, uint n,
+                        const SaidasSemaforo *saidas, PlanoId plano, uint32_t agora);
+
+// Avança as instâncias com prazo vencido; retorna quantos ms faltam para o
+// próximo prazo do lote
+uint32_t semaforo_lote_passo(SemaforoLote *l, uint32_t agora);
+
+#endif // SEMAFORO_H
@@ -0,0 +1,71 @@
+#include "sincronia.h"
+
+// Ganhos da malha por pulso: metade do erro vai para a fase e um oitavo, por
+// período, para a deriva. Os polos ficam em 0,71 (sem oscilação divergente),
+// e o erro cai a ~1% em uns 15 pulsos.
+#define GANHO_FASE 2
+#define GANHO_DERIVA 8
+
+static int64_t modulo(int64_t x, int64_t m) {
+    int64_t r = x % m;
+    return r < 0 ? r + m : r;
+}
+
+void sincronia_init(Sincronia *s, uint32_t periodo_ms) {
+    *s = (Sincronia){.periodo_us = periodo_ms * 1000};
+}
+
+int64_t sincronia_desvio_us(const Sincronia *s, uint64_t agora_us) {
+    // Em ms para não estourar com dias sem pulso
+    int64_t decorrido_ms = (int64_t)(agora_us - s->ultima_borda_us) / 1000;
+    return s->desvio_us + (int64_t)s->deriva_ppb * decorrido_ms / 1000000;
+}
+
+void sincronia_pulso(Sincronia *s, uint64_t borda_us) {
+    // Na borda a rede está num múltiplo do período; o erro é o que falta à
+    // estimativa para cair no múltiplo mais próximo
+    int64_t desvio = sincronia_desvio_us(s, borda_us);
+    int64_t fase = modulo((int64_t)borda_us + desvio, s->periodo_us);
+    int64_t erro = fase > s->periodo_us / 2 ? s->periodo_us - fase : -fase;
+
+    if (!s->travada) {
+        s->desvio_us = desvio + erro;
+        s->deriva_ppb = 0;
+        s->ultima_borda_us = borda_us;
+        s->ultimo_erro_us = 0;
+        s->rejeicoes = 0;
+        s->travada = true;
+        s->pulsos++;
+        return;
+    }
+
+    if (erro > SINCRONIA_ERRO_MAXIMO_US || erro < -SINCRONIA_ERRO_MAXIMO_US) {
+        if (++s->rejeicoes >= SINCRONIA_REJEICOES_MAXIMAS)
+            s->travada = false;
+        return;
+    }
+    s->rejeicoes = 0;
+
+    int64_t deriva = s->deriva_ppb + erro * 1000000000 / s->periodo_us / GANHO_DERIVA;
+    if (deriva > SINCRONIA_DERIVA_MAXIMA_PPB)
+        deriva = SINCRONIA_DERIVA_MAXIMA_PPB;
+    if (deriva < -SINCRONIA_DERIVA_MAXIMA_PPB)
+        deriva = -SINCRONIA_DERIVA_MAXIMA_PPB;
+
+    s->desvio_us = desvio + erro / GANHO_FASE;
+    s->deriva_ppb = (int32_t)deriva;
+    s->ultima_borda_us = borda_us;
+    s->ultimo_erro_us = (int32_t)erro;
+    s->pulsos++;
+}
+
+uint32_t sincronia_defasagem_local(const Sincronia *s, uint32_t defasagem_rede, uint64_t agora_us) {
+    // Início do ciclo corrente da rede no relógio local, arredondado ao ms.
+    // Fica sempre no passado: o semáforo faz (agora - defasagem) % ciclo em 32
+    // bits, e 2^32 não é múltiplo do ciclo. Somar o período evita negativos
+    // logo depois do boot; o resultado vale módulo 2^32, como o próprio agora.
+    int64_t periodo = s->periodo_us;
+    int64_t rede_us = (int64_t)agora_us + sincronia_desvio_us(s, agora_us);
+    uint64_t passado = modulo(rede_us - (int64_t)defasagem_rede * 1000, periodo);
+    return (uint32_t)((agora_us + periodo - passado + 500) / 1000 - periodo / 1000);
+}
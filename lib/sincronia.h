@@ -0,0 +1,55 @@
+#ifndef SINCRONIA_H
+#define SINCRONIA_H
+
+// Sincronia de ciclo entre placas do corredor. A mestra gera um pulso a cada
+// período do seu relógio (o relógio da rede); cada escrava marca o instante da
+// borda no seu relógio e mantém uma estimativa de rede - local, com a deriva
+// do cristal, por uma malha de fase de segunda ordem (proporcional +
+// integral). A defasagem do plano coordenado, dada no relógio da rede, é
+// convertida para o relógio da placa a cada passo; a correção entra pelo
+// ajuste do início de ciclo do semáforo, que nunca encurta o verde abaixo do
+// mínimo.
+//
+// O período do pulso tem de ser múltiplo do ciclo coordenado: a rede só é
+// conhecida módulo o período.
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Erro de fase acima disto, já travado, é tratado como borda espúria
+#ifndef SINCRONIA_ERRO_MAXIMO_US
+#define SINCRONIA_ERRO_MAXIMO_US 50000
+#endif
+// Bordas espúrias seguidas que fazem a escrava travar de novo (a mestra
+// reiniciou ou mudou de relógio)
+#define SINCRONIA_REJEICOES_MAXIMAS 4
+// Limite da deriva estimada; cristais comuns ficam abaixo de 100 ppm
+#define SINCRONIA_DERIVA_MAXIMA_PPB 500000
+
+typedef struct {
+    uint32_t periodo_us;
+    int64_t desvio_us;          // rede - local na última borda aceita
+    int32_t deriva_ppb;         // quanto o desvio anda por µs local, em ppb
+    uint64_t ultima_borda_us;
+    int32_t ultimo_erro_us;
+    uint32_t pulsos;            // bordas aceitas
+    uint8_t rejeicoes;          // bordas espúrias seguidas
+    bool travada;
+} Sincronia;
+
+// Sem pulsos a rede é o próprio relógio da placa (desvio 0): é o caso da
+// mestra e o de uma escrava ainda sem sinal
+void sincronia_init(Sincronia *s, uint32_t periodo_ms);
+
+// Borda de um pulso, no relógio local; chamada pela tarefa do semáforo com o
+// instante marcado na interrupção
+void sincronia_pulso(Sincronia *s, uint64_t borda_us);
+
+// rede - local no instante dado, com a deriva
+int64_t sincronia_desvio_us(const Sincronia *s, uint64_t agora_us);
+
+// Defasagem no relógio de ms da placa (o agora de semaforo_passo, que dá a
+// volta em 32 bits) equivalente à defasagem dada no relógio da rede
+uint32_t sincronia_defasagem_local(const Sincronia *s, uint32_t defasagem_rede, uint64_t agora_us);
+
+#endif // SINCRONIA_H
@@ -1,5 +1,6 @@
 #include "ssd1306.h"
 #include "font.h"
+#include <string.h>
 
 void ssd1306_init(ssd1306_t *ssd, uint8_t width, uint8_t height, bool external_vcc, uint8_t address, i2c_inst_t *i2c) {
   ssd->width = width;
@@ -11,6 +12,33 @@ void ssd1306_init(ssd1306_t *ssd, uint8_t width, uint8_t height, bool external_v
   ssd->ram_buffer = calloc(ssd->bufsize, sizeof(uint8_t));
   ssd->ram_buffer[0] = 0x40;
   ssd->port_buffer[0] = 0x80;
+  ssd->shadow_buffer = calloc(ssd->bufsize, sizeof(uint8_t));
+  ssd->tx_buffer = calloc(SSD1306_TX_MAX, sizeof(uint8_t));
+  ssd1306_i2c_transport(&ssd->transport, i2c);
+  ssd1306_invalidate(ssd);
+}
+
+void ssd1306_set_transport(ssd1306_t *ssd, const ssd1306_transport_t *transport) {
+  ssd1306_wait(ssd);
+  ssd->transport = *transport;
+}
+
+// Aguarda o fim de um envio assíncrono em andamento; termina mesmo sem o
+// painel, porque o transporte chama done com falha depois do seu timeout
+void ssd1306_wait(ssd1306_t *ssd) {
+  while (ssd->busy)
+    tight_loop_contents();
+}
+
+// Desiste de um envio assíncrono que não terminou, sem chamar done. O que o
+// painel recebeu é desconhecido: o próximo envio transmite a tela inteira.
+void ssd1306_abort(ssd1306_t *ssd) {
+  if (!ssd->busy)
+    return;
+  if (ssd->transport.abort)
+    ssd->transport.abort(ssd->transport.ctx);
+  ssd->failed = true;
+  ssd->busy = false;
 }
 
 void ssd1306_config(ssd1306_t *ssd) {
@@ -42,76 +70,376 @@ void ssd1306_config(ssd1306_t *ssd) {
 }
 
 void ssd1306_command(ssd1306_t *ssd, uint8_t command) {
+  ssd1306_wait(ssd);
   ssd->port_buffer[1] = command;
-  i2c_write_blocking(
-    ssd->i2c_port,
+  ssd->transport.write(
+    ssd->transport.ctx,
     ssd->address,
     ssd->port_buffer,
-    2,
-    false
+    2
   );
 }
 
-void ssd1306_send_data(ssd1306_t *ssd) {
-  ssd1306_command(ssd, SET_COL_ADDR);
-  ssd1306_command(ssd, 0);
-  ssd1306_command(ssd, ssd->width - 1);
-  ssd1306_command(ssd, SET_PAGE_ADDR);
-  ssd1306_command(ssd, 0);
-  ssd1306_command(ssd, ssd->pages - 1);
-  i2c_write_blocking(
-    ssd->i2c_port,
+void ssd1306_contrast(ssd1306_t *ssd, uint8_t value) {
+  ssd1306_command(ssd, SET_CONTRAST);
+  ssd1306_command(ssd, value);
+}
+
+// Desligado, o painel mantém a GDDRAM e consome só alguns µA
+void ssd1306_power(ssd1306_t *ssd, bool on) {
+  ssd1306_command(ssd, SET_DISP | (on ? 0x01 : 0x00));
+}
+
+// Marca como sujas as colunas x0..x1 de todas as páginas cobertas por y0..y1
+void ssd1306_mark_dirty(ssd1306_t *ssd, uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1) {
+  if (x0 >= ssd->width || y0 >= ssd->height || x0 > x1 || y0 > y1)
+    return;
+  if (x1 >= ssd->width)
+    x1 = ssd->width - 1;
+  if (y1 >= ssd->height)
+    y1 = ssd->height - 1;
+  for (uint8_t page = y0 >> 3; page <= (y1 >> 3); ++page) {
+    if (x0 < ssd->dirty_x0[page])
+      ssd->dirty_x0[page] = x0;
+    if (x1 > ssd->dirty_x1[page])
+      ssd->dirty_x1[page] = x1;
+  }
+}
+
+// Esquece o que está no painel: o próximo envio transmite a tela inteira
+void ssd1306_invalidate(ssd1306_t *ssd) {
+  ssd->shadow_valid = false;
+  for (uint8_t page = 0; page < ssd->pages; ++page) {
+    ssd->dirty_x0[page] = 0;
+    ssd->dirty_x1[page] = ssd->width - 1;
+  }
+}
+
+// Recorta a faixa suja da página removendo as colunas iguais ao que o painel já tem
+static bool ssd1306_trim_page(ssd1306_t *ssd, uint8_t page) {
+  uint8_t x0 = ssd->dirty_x0[page];
+  uint8_t x1 = ssd->dirty_x1[page];
+  if (x0 > x1)
+    return false;
+  if (ssd->shadow_valid) {
+    const uint8_t *ram = ssd->ram_buffer + 1 + page;
+    const uint8_t *shadow = ssd->shadow_buffer + 1 + page;
+    while (x0 <= x1 && ram[x0 * ssd->pages] == shadow[x0 * ssd->pages])
+      ++x0;
+    while (x1 > x0 && ram[x1 * ssd->pages] == shadow[x1 * ssd->pages])
+      --x1;
+    if (x0 > x1) {
+      ssd->dirty_x0[page] = 0xFF;
+      ssd->dirty_x1[page] = 0;
+      return false;
+    }
+  }
+  ssd->dirty_x0[page] = x0;
+  ssd->dirty_x1[page] = x1;
+  return true;
+}
+
+// Monta em tx_buffer uma transação com os comandos de endereçamento e os dados da
+// janela x0..x1 / p0..p1 (modo de endereçamento vertical)
+static size_t ssd1306_build_window(ssd1306_t *ssd, size_t len, uint8_t x0, uint8_t x1, uint8_t p0, uint8_t p1) {
+  const uint8_t header[] = {SET_COL_ADDR, x0, x1, SET_PAGE_ADDR, p0, p1};
+  uint8_t *tx = ssd->tx_buffer;
+  for (uint8_t i = 0; i < sizeof(header); ++i) {
+    tx[len++] = 0x80;
+    tx[len++] = header[i];
+  }
+  tx[len++] = 0x40;
+  for (uint16_t x = x0; x <= x1; ++x) {
+    uint16_t index = 1 + x * ssd->pages + p0;
+    for (uint8_t page = p0; page <= p1; ++page, ++index) {
+      tx[len++] = ssd->ram_buffer[index];
+      ssd->shadow_buffer[index] = ssd->ram_buffer[index];
+    }
+  }
+  return len;
+}
+
+// Bytes de uma janela além dos dados: endereço do I2C e cabeçalho
+#define SSD1306_WINDOW_COST (1 + SSD1306_WINDOW_HEADER)
+
+// Copia as páginas alteradas para tx_buffer, uma transação por grupo de páginas
+// sujas consecutivas. Uma página só entra no grupo se a janela maior custar no
+// máximo o que custaria uma janela só para ela: mudanças em colunas distantes
+// de páginas vizinhas vão em janelas separadas. Depois disso ram_buffer pode
+// ser redesenhado enquanto o quadro montado é transmitido.
+static void ssd1306_build_frame(ssd1306_t *ssd) {
+  size_t len = 0;
+  if (ssd->failed) {
+    ssd->failed = false;
+    ssd1306_invalidate(ssd);
+  }
+  uint8_t page = 0;
+  ssd->segment_count = 0;
+  ssd->segment_next = 0;
+  while (page < ssd->pages) {
+    if (!ssd1306_trim_page(ssd, page)) {
+      ++page;
+      continue;
+    }
+    uint8_t p0 = page;
+    uint8_t x0 = ssd->dirty_x0[page];
+    uint8_t x1 = ssd->dirty_x1[page];
+    while (page + 1 < ssd->pages && ssd1306_trim_page(ssd, page + 1)) {
+      uint8_t a = ssd->dirty_x0[page + 1];
+      uint8_t b = ssd->dirty_x1[page + 1];
+      uint8_t u0 = a < x0 ? a : x0;
+      uint8_t u1 = b > x1 ? b : x1;
+      uint16_t n = page - p0 + 1;
+      uint16_t junta = (u1 - u0 + 1) * (n + 1) - (x1 - x0 + 1) * n;
+      if (junta > SSD1306_WINDOW_COST + (b - a + 1))
+        break;
+      ++page;
+      x0 = u0;
+      x1 = u1;
+    }
+    len = ssd1306_build_window(ssd, len, x0, x1, p0, page);
+    ssd->segment_end[ssd->segment_count++] = len;
+    ++page;
+  }
+
+  for (page = 0; page < ssd->pages; ++page) {
+    ssd->dirty_x0[page] = 0xFF;
+    ssd->dirty_x1[page] = 0;
+  }
+  ssd->shadow_valid = true;
+}
+
+static void ssd1306_segment_done(void *arg, bool ok);
+
+static void ssd1306_start_segment(ssd1306_t *ssd) {
+  uint8_t i = ssd->segment_next;
+  uint16_t start = i ? ssd->segment_end[i - 1] : 0;
+  ssd->transport.write_async(
+    ssd->transport.ctx,
     ssd->address,
-    ssd->ram_buffer,
-    ssd->bufsize,
-    false
+    ssd->tx_buffer + start,
+    ssd->segment_end[i] - start,
+    ssd1306_segment_done,
+    ssd
   );
 }
 
+// Chamada pelo transporte (normalmente em interrupção) ao fim de cada
+// transação; numa falha as transações restantes do quadro são descartadas
+static void ssd1306_segment_done(void *arg, bool ok) {
+  ssd1306_t *ssd = arg;
+  if (ok && ++ssd->segment_next < ssd->segment_count) {
+    ssd1306_start_segment(ssd);
+    return;
+  }
+  if (!ok)
+    ssd->failed = true;
+  ssd->busy = false;
+  if (ssd->done)
+    ssd->done(ssd->done_arg, ok);
+}
+
+// Envia apenas as páginas alteradas e retorna quando a transmissão termina
+void ssd1306_send_data(ssd1306_t *ssd) {
+  ssd1306_wait(ssd);
+  ssd1306_build_frame(ssd);
+  uint16_t start = 0;
+  for (uint8_t i = 0; i < ssd->segment_count; ++i) {
+    ssd->transport.write(
+      ssd->transport.ctx,
+      ssd->address,
+      ssd->tx_buffer + start,
+      ssd->segment_end[i] - start
+    );
+    start = ssd->segment_end[i];
+  }
+}
+
+// Inicia o envio das páginas alteradas e retorna imediatamente. Retorna true se
+// há transmissão em andamento; nesse caso done(arg, ok) é chamado ao terminar,
+// possivelmente em contexto de interrupção. Sem write_async no transporte o
+// envio é feito de forma bloqueante e a função retorna false.
+bool ssd1306_send_data_async(ssd1306_t *ssd, ssd1306_done_cb_t done, void *arg) {
+  if (!ssd->transport.write_async) {
+    ssd1306_send_data(ssd);
+    return false;
+  }
+  ssd1306_wait(ssd);
+  ssd1306_build_frame(ssd);
+  if (ssd->segment_count == 0)
+    return false;
+  if (ssd->transport.prepare)
+    ssd->transport.prepare(ssd->transport.ctx, ssd->tx_buffer, ssd->segment_end[ssd->segment_count - 1]);
+  ssd->done = done;
+  ssd->done_arg = arg;
+  ssd->busy = true;
+  ssd1306_start_segment(ssd);
+  return true;
+}
+
 void ssd1306_pixel(ssd1306_t *ssd, uint8_t x, uint8_t y, bool value) {
   uint16_t index = (y >> 3) + (x << 3) + 1;
   uint8_t pixel = (y & 0b111);
+  uint8_t page = y >> 3;
+  if (x < ssd->dirty_x0[page])
+    ssd->dirty_x0[page] = x;
+  if (x > ssd->dirty_x1[page])
+    ssd->dirty_x1[page] = x;
   if (value)
     ssd->ram_buffer[index] |= (1 << pixel);
   else
     ssd->ram_buffer[index] &= ~(1 << pixel);
 }
 
-/*
 void ssd1306_fill(ssd1306_t *ssd, bool value) {
-  uint8_t byte = value ? 0xFF : 0x00;
-  for (uint8_t i = 1; i < ssd->bufsize; ++i)
-    ssd->ram_buffer[i] = byte;
-}*/
+  // O buffer inteiro é escrito de uma vez (memset usa palavras de 32 bits quando alinhado)
+  memset(ssd->ram_buffer + 1, value ? 0xFF : 0x00, ssd->bufsize - 1);
+  ssd1306_mark_dirty(ssd, 0, 0, ssd->width - 1, ssd->height - 1);
+}
 
-void ssd1306_fill(ssd1306_t *ssd, bool value) {
-    // Itera por todas as posições do display
-    for (uint8_t y = 0; y < ssd->height; ++y) {
-        for (uint8_t x = 0; x < ssd->width; ++x) {
-            ssd1306_pixel(ssd, x, y, value);
-        }
+// Descompacta um quadro inteiro em RLE (formato de tools/bitmap_rle.c) direto no
+// buffer: 0x00..0x7F = literal de n + 1 bytes, 0x80..0xFF = n - 0x7F bytes zero
+void ssd1306_draw_rle(ssd1306_t *ssd, const uint8_t *rle) {
+  uint8_t *dst = ssd->ram_buffer + 1;
+  uint8_t *end = ssd->ram_buffer + ssd->bufsize;
+  while (dst < end) {
+    uint8_t token = *rle++;
+    if (token & 0x80) {
+      uint8_t count = token - 0x7F;
+      memset(dst, 0, count);
+      dst += count;
+    } else {
+      uint8_t count = token + 1;
+      memcpy(dst, rle, count);
+      rle += count;
+      dst += count;
     }
+  }
+  ssd1306_mark_dirty(ssd, 0, 0, ssd->width - 1, ssd->height - 1);
 }
 
+// Aplica um delta (trechos página/coluna/quantidade/bytes terminados por 0xFF)
+// sobre o quadro atual, marcando como sujos apenas os trechos escritos
+void ssd1306_apply_delta(ssd1306_t *ssd, const uint8_t *delta) {
+  while (*delta != 0xFF) {
+    uint8_t page = *delta++;
+    uint8_t x = *delta++;
+    uint8_t count = *delta++;
+    uint8_t *dst = ssd->ram_buffer + 1 + x * ssd->pages + page;
+    for (uint8_t i = 0; i < count; ++i, dst += ssd->pages)
+      *dst = *delta++;
+    if (x < ssd->dirty_x0[page])
+      ssd->dirty_x0[page] = x;
+    if (x + count - 1 > ssd->dirty_x1[page])
+      ssd->dirty_x1[page] = x + count - 1;
+  }
+}
 
-
-void ssd1306_rect(ssd1306_t *ssd, uint8_t top, uint8_t left, uint8_t width, uint8_t height, bool value, bool fill) {
-  for (uint8_t x = left; x < left + width; ++x) {
-    ssd1306_pixel(ssd, x, top, value);
-    ssd1306_pixel(ssd, x, top + height - 1, value);
+// Combina v (já deslocado e restrito a m) com o byte de destino conforme a operação
+static inline uint8_t ssd1306_rop(uint8_t dst, uint8_t v, uint8_t m, ssd1306_rop_t rop) {
+  switch (rop) {
+    case SSD1306_ROP_OR:
+      return dst | v;
+    case SSD1306_ROP_AND:
+      return dst & (v | ~m);
+    case SSD1306_ROP_XOR:
+      return dst ^ v;
+    case SSD1306_ROP_REPLACE:
+    default:
+      return (dst & ~m) | v;
   }
-  for (uint8_t y = top; y < top + height; ++y) {
-    ssd1306_pixel(ssd, left, y, value);
-    ssd1306_pixel(ssd, left + width - 1, y, value);
+}
+
+// Desenha um bitmap de w x h pixels em (x, y), cortando o que sai da tela.
+// O bitmap usa o mesmo layout do buffer: w colunas de (h + 7) / 8 bytes, bit 0
+// em cima. Com y fora do múltiplo de 8 cada byte é dividido entre duas páginas.
+void ssd1306_blit(ssd1306_t *ssd, const uint8_t *bitmap, uint8_t w, uint8_t h, int x, int y, ssd1306_rop_t rop) {
+  int x0 = x < 0 ? 0 : x;
+  int x1 = x + w > ssd->width ? ssd->width : x + w;
+  int y0 = y < 0 ? 0 : y;
+  int y1 = y + h > ssd->height ? ssd->height : y + h;
+  if (x0 >= x1 || y0 >= y1)
+    return;
+
+  uint8_t src_pages = (h + 7) / 8;
+  uint8_t last_mask = (h & 7) ? 0xFF >> (8 - (h & 7)) : 0xFF;
+
+  for (uint8_t sp = 0; sp < src_pages; ++sp) {
+    int row = y + sp * 8;
+    if (row <= -8 || row >= ssd->height)
+      continue;
+    int page = row < 0 ? -1 : row >> 3;
+    uint8_t shift = row - page * 8;
+    uint8_t mask = (sp == src_pages - 1) ? last_mask : 0xFF;
+    uint16_t m16 = (uint16_t)mask << shift;
+    bool has_lo = page >= 0;
+    bool has_hi = shift && page + 1 < ssd->pages;
+
+    const uint8_t *src = bitmap + (x0 - x) * src_pages + sp;
+    uint8_t *dst = ssd->ram_buffer + 1 + x0 * ssd->pages + page;
+    for (int cx = x0; cx < x1; ++cx, src += src_pages, dst += ssd->pages) {
+      uint16_t v16 = (uint16_t)(*src & mask) << shift;
+      if (has_lo)
+        dst[0] = ssd1306_rop(dst[0], v16, m16, rop);
+      if (has_hi)
+        dst[1] = ssd1306_rop(dst[1], v16 >> 8, m16 >> 8, rop);
+    }
   }
+  ssd1306_mark_dirty(ssd, x0, y0, x1 - 1, y1 - 1);
+}
 
-  if (fill) {
-    for (uint8_t x = left + 1; x < left + width - 1; ++x) {
-      for (uint8_t y = top + 1; y < top + height - 1; ++y) {
-        ssd1306_pixel(ssd, x, y, value);
+// Preenche as linhas y0..y1 das colunas x0..x1. Cada coluna ocupa bytes
+// consecutivos (um por página), então as páginas internas recebem bytes
+// inteiros e só as páginas das bordas usam máscara.
+static void ssd1306_fill_span(ssd1306_t *ssd, uint8_t x0, uint8_t x1, uint8_t y0, uint8_t y1, bool value) {
+  if (x0 >= ssd->width || y0 >= ssd->height || x0 > x1 || y0 > y1)
+    return;
+  if (x1 >= ssd->width)
+    x1 = ssd->width - 1;
+  if (y1 >= ssd->height)
+    y1 = ssd->height - 1;
+
+  uint8_t p0 = y0 >> 3, p1 = y1 >> 3;
+  uint8_t mask0 = 0xFF << (y0 & 7);
+  uint8_t mask1 = 0xFF >> (7 - (y1 & 7));
+  if (p0 == p1)
+    mask0 &= mask1;
+
+  // Colunas inteiras são contíguas no buffer: um único memset
+  if (p0 == 0 && p1 == ssd->pages - 1 && mask0 == 0xFF && mask1 == 0xFF) {
+    memset(ssd->ram_buffer + 1 + x0 * ssd->pages, value ? 0xFF : 0x00, (x1 - x0 + 1) * ssd->pages);
+  } else {
+    uint8_t *column = ssd->ram_buffer + 1 + x0 * ssd->pages;
+    for (uint16_t x = x0; x <= x1; ++x, column += ssd->pages) {
+      if (value) {
+        column[p0] |= mask0;
+        if (p1 != p0)
+          column[p1] |= mask1;
+      } else {
+        column[p0] &= ~mask0;
+        if (p1 != p0)
+          column[p1] &= ~mask1;
       }
+      if (p1 > p0 + 1)
+        memset(column + p0 + 1, value ? 0xFF : 0x00, p1 - p0 - 1);
     }
   }
+  ssd1306_mark_dirty(ssd, x0, y0, x1, y1);
+}
+
+void ssd1306_rect(ssd1306_t *ssd, uint8_t top, uint8_t left, uint8_t width, uint8_t height, bool value, bool fill) {
+  if (width == 0 || height == 0)
+    return;
+  uint8_t right = left + width - 1;
+  uint8_t bottom = top + height - 1;
+  if (fill) {
+    ssd1306_fill_span(ssd, left, right, top, bottom, value);
+    return;
+  }
+  ssd1306_hline(ssd, left, right, top, value);
+  ssd1306_hline(ssd, left, right, bottom, value);
+  ssd1306_vline(ssd, left, top, bottom, value);
+  ssd1306_vline(ssd, right, top, bottom, value);
 }
 
 void ssd1306_line(ssd1306_t *ssd, uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1, bool value) {
@@ -144,40 +472,88 @@ void ssd1306_line(ssd1306_t *ssd, uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1
 
 
 void ssd1306_hline(ssd1306_t *ssd, uint8_t x0, uint8_t x1, uint8_t y, bool value) {
-  for (uint8_t x = x0; x <= x1; ++x)
-    ssd1306_pixel(ssd, x, y, value);
+  if (x0 >= ssd->width || y >= ssd->height || x0 > x1)
+    return;
+  if (x1 >= ssd->width)
+    x1 = ssd->width - 1;
+  // Mesmo bit em colunas vizinhas: avança de uma coluna (ssd->pages bytes) por vez
+  uint8_t mask = 1 << (y & 7);
+  uint8_t *byte = ssd->ram_buffer + 1 + x0 * ssd->pages + (y >> 3);
+  uint8_t *end = byte + (x1 - x0) * ssd->pages;
+  if (value) {
+    for (; byte <= end; byte += ssd->pages)
+      *byte |= mask;
+  } else {
+    for (; byte <= end; byte += ssd->pages)
+      *byte &= ~mask;
+  }
+  ssd1306_mark_dirty(ssd, x0, y, x1, y);
 }
 
 void ssd1306_vline(ssd1306_t *ssd, uint8_t x, uint8_t y0, uint8_t y1, bool value) {
-  for (uint8_t y = y0; y <= y1; ++y)
-    ssd1306_pixel(ssd, x, y, value);
+  ssd1306_fill_span(ssd, x, x, y0, y1, value);
 }
 
-// Função para desenhar um caractere
-void ssd1306_draw_char(ssd1306_t *ssd, char c, uint8_t x, uint8_t y)
-{
-  uint16_t index = 0;
+// Retorna o glifo do caractere na fonte; fora da faixa ASCII usa o espaço
+static const uint8_t *ssd1306_glyph(char c) {
+  if (c >= ' ' && c <= '~')
+    return &font[(c - ' ') * 8];
+  return &font[0];
+}
 
-  // Verifica o caractere e calcula o índice correspondente na fonte
-  if (c >= ' ' && c <= '~') // Verifica se o caractere está na faixa ASCII válida
-  {
-    index = (c - ' ') * 8; // Calcula o índice baseado na posição do caractere na tabela ASCII
-  }
-  else
-  {
-    // Caractere inválido, desenha um espaço (ou pode ser tratado de outra forma)
-    index = 0; // Índice 0 corresponde ao caractere "nada" (espaço)
-  }
+// Copia as colunas do glifo 8x8 direto no buffer até a coluna x_end (exclusiva).
+// Cada coluna do glifo é um byte: com y múltiplo de 8 é uma escrita por coluna,
+// senão duas escritas deslocadas nas páginas vizinhas.
+static void ssd1306_blit_glyph(ssd1306_t *ssd, const uint8_t *glyph, uint8_t x, uint8_t y, uint16_t x_end, ssd1306_text_mode_t mode) {
+  if (x >= ssd->width || y >= ssd->height)
+    return;
+  if (x_end > ssd->width)
+    x_end = ssd->width;
+  if (x_end > x + 8)
+    x_end = x + 8;
+  if (x_end <= x)
+    return;
 
-  // Desenha o caractere na tela
-  for (uint8_t i = 0; i < 8; ++i)
-  {
-    uint8_t line = font[index + i]; // Acessa a linha correspondente do caractere na fonte
-    for (uint8_t j = 0; j < 8; ++j)
-    {
-      ssd1306_pixel(ssd, x + i, y + j, line & (1 << j)); // Desenha cada pixel do caractere
+  uint8_t page = y >> 3;
+  uint8_t shift = y & 7;
+  bool has_next = shift && page + 1 < ssd->pages;
+  uint8_t mask_lo = 0xFF << shift;
+  uint8_t mask_hi = 0xFF >> (8 - shift);
+  uint8_t *column = ssd->ram_buffer + 1 + x * ssd->pages + page;
+
+  for (uint16_t cx = x; cx < x_end; ++cx, ++glyph, column += ssd->pages) {
+    uint8_t bits = (mode == SSD1306_TEXT_INVERSE) ? ~*glyph : *glyph;
+    if (shift == 0) {
+      if (mode == SSD1306_TEXT_TRANSPARENT)
+        column[0] |= bits;
+      else
+        column[0] = bits;
+      continue;
+    }
+    uint8_t lo = bits << shift;
+    uint8_t hi = bits >> (8 - shift);
+    if (mode == SSD1306_TEXT_TRANSPARENT) {
+      column[0] |= lo;
+      if (has_next)
+        column[1] |= hi;
+    } else {
+      column[0] = (column[0] & ~mask_lo) | lo;
+      if (has_next)
+        column[1] = (column[1] & ~mask_hi) | hi;
     }
   }
+  ssd1306_mark_dirty(ssd, x, y, x_end - 1, y + 7);
+}
+
+// Função para desenhar um caractere
+void ssd1306_draw_char(ssd1306_t *ssd, char c, uint8_t x, uint8_t y)
+{
+  ssd1306_blit_glyph(ssd, ssd1306_glyph(c), x, y, x + 8, SSD1306_TEXT_NORMAL);
+}
+
+void ssd1306_draw_char_mode(ssd1306_t *ssd, char c, uint8_t x, uint8_t y, ssd1306_text_mode_t mode)
+{
+  ssd1306_blit_glyph(ssd, ssd1306_glyph(c), x, y, x + 8, mode);
 }
 
 // Função para desenhar uma string
@@ -197,4 +573,26 @@ void ssd1306_draw_string(ssd1306_t *ssd, const char *str, uint8_t x, uint8_t y)
       break;
     }
   }
-}
\ No newline at end of file
+}
+
+// Largura em pixels da string desenhada em uma única linha
+uint16_t ssd1306_measure_string(const char *str)
+{
+  return strlen(str) * 8;
+}
+
+// Desenha a string em uma única linha, sem quebra, cortando no limite de
+// max_width pixels a partir de x (ou na borda do display). Retorna a largura desenhada.
+uint16_t ssd1306_draw_string_clipped(ssd1306_t *ssd, const char *str, uint8_t x, uint8_t y, uint8_t max_width, ssd1306_text_mode_t mode)
+{
+  uint16_t x_end = x + max_width;
+  uint16_t cx = x;
+  if (x_end > ssd->width)
+    x_end = ssd->width;
+  while (*str && cx < x_end)
+  {
+    ssd1306_blit_glyph(ssd, ssd1306_glyph(*str++), cx, y, x_end, mode);
+    cx += 8;
+  }
+  return (cx < x_end ? cx : x_end) - x;
+}
@@ -1,9 +1,15 @@
+#ifndef SSD1306_H
+#define SSD1306_H
+
 #include <stdlib.h>
-#include "pico/stdlib.h"
-#include "hardware/i2c.h"
+#include "hal.h"
 
 #define WIDTH 128
 #define HEIGHT 64
+#define SSD1306_MAX_PAGES (HEIGHT / 8)
+// Cabeçalho de uma janela: 6 comandos com byte de controle 0x80 + byte 0x40 de dados
+#define SSD1306_WINDOW_HEADER 13
+#define SSD1306_TX_MAX (WIDTH * SSD1306_MAX_PAGES + SSD1306_MAX_PAGES * SSD1306_WINDOW_HEADER)
 
 typedef enum {
   SET_CONTRAST = 0x81,
@@ -25,6 +31,35 @@ typedef enum {
   SET_CHARGE_PUMP = 0x8D
 } ssd1306_command_t;
 
+typedef enum {
+  SSD1306_TEXT_NORMAL,      // glifo opaco: pixels acesos e apagados
+  SSD1306_TEXT_INVERSE,     // glifo opaco com as cores invertidas
+  SSD1306_TEXT_TRANSPARENT  // acende apenas os pixels do glifo
+} ssd1306_text_mode_t;
+
+// Operação usada por ssd1306_blit para combinar o bitmap com o buffer
+typedef enum {
+  SSD1306_ROP_REPLACE,  // copia o bitmap, inclusive os pixels apagados
+  SSD1306_ROP_OR,
+  SSD1306_ROP_AND,
+  SSD1306_ROP_XOR
+} ssd1306_rop_t;
+
+// ok é false se o painel não confirmou (NACK) ou o envio passou do tempo
+typedef void (*ssd1306_done_cb_t)(void *arg, bool ok);
+
+// Meio de envio dos bytes ao controlador; write_async, prepare e abort podem
+// ser NULL. write_async tem de chamar done sempre, com falha no pior caso.
+// prepare recebe o quadro montado inteiro, fora de interrupção, antes das
+// suas transações; abort desiste da transação em andamento sem chamar done.
+typedef struct {
+  void (*write)(void *ctx, uint8_t address, const uint8_t *src, size_t len);
+  void (*write_async)(void *ctx, uint8_t address, const uint8_t *src, size_t len, ssd1306_done_cb_t done, void *arg);
+  void (*prepare)(void *ctx, const uint8_t *src, size_t len);
+  void (*abort)(void *ctx);
+  void *ctx;
+} ssd1306_transport_t;
+
 typedef struct {
   uint8_t width, height, pages, address;
   i2c_inst_t *i2c_port;
@@ -32,18 +67,49 @@ typedef struct {
   uint8_t *ram_buffer;
   size_t bufsize;
   uint8_t port_buffer[2];
+  uint8_t *shadow_buffer;   // conteúdo presente na GDDRAM do painel
+  uint8_t *tx_buffer;       // janelas montadas para envio (comandos + dados)
+  bool shadow_valid;
+  uint8_t dirty_x0[SSD1306_MAX_PAGES], dirty_x1[SSD1306_MAX_PAGES];
+  ssd1306_transport_t transport;
+  uint16_t segment_end[SSD1306_MAX_PAGES];
+  uint8_t segment_count, segment_next;
+  volatile bool busy;
+  volatile bool failed;     // o último envio falhou: o painel está desconhecido
+  ssd1306_done_cb_t done;
+  void *done_arg;
 } ssd1306_t;
 
+// Transportes para o I2C do RP2040 (ssd1306_i2c.c)
+void ssd1306_i2c_transport(ssd1306_transport_t *transport, i2c_inst_t *i2c);
+void ssd1306_i2c_dma_init(ssd1306_t *ssd);
+
 void ssd1306_init(ssd1306_t *ssd, uint8_t width, uint8_t height, bool external_vcc, uint8_t address, i2c_inst_t *i2c);
 void ssd1306_config(ssd1306_t *ssd);
 void ssd1306_command(ssd1306_t *ssd, uint8_t command);
+void ssd1306_contrast(ssd1306_t *ssd, uint8_t value);
+void ssd1306_power(ssd1306_t *ssd, bool on);
 void ssd1306_send_data(ssd1306_t *ssd);
+bool ssd1306_send_data_async(ssd1306_t *ssd, ssd1306_done_cb_t done, void *arg);
+void ssd1306_wait(ssd1306_t *ssd);
+void ssd1306_abort(ssd1306_t *ssd);
+void ssd1306_set_transport(ssd1306_t *ssd, const ssd1306_transport_t *transport);
+void ssd1306_mark_dirty(ssd1306_t *ssd, uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1);
+void ssd1306_invalidate(ssd1306_t *ssd);
 
 void ssd1306_pixel(ssd1306_t *ssd, uint8_t x, uint8_t y, bool value);
 void ssd1306_fill(ssd1306_t *ssd, bool value);
+void ssd1306_draw_rle(ssd1306_t *ssd, const uint8_t *rle);
+void ssd1306_apply_delta(ssd1306_t *ssd, const uint8_t *delta);
+void ssd1306_blit(ssd1306_t *ssd, const uint8_t *bitmap, uint8_t w, uint8_t h, int x, int y, ssd1306_rop_t rop);
 void ssd1306_rect(ssd1306_t *ssd, uint8_t top, uint8_t left, uint8_t width, uint8_t height, bool value, bool fill);
 void ssd1306_line(ssd1306_t *ssd, uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1, bool value);
 void ssd1306_hline(ssd1306_t *ssd, uint8_t x0, uint8_t x1, uint8_t y, bool value);
 void ssd1306_vline(ssd1306_t *ssd, uint8_t x, uint8_t y0, uint8_t y1, bool value);
 void ssd1306_draw_char(ssd1306_t *ssd, char c, uint8_t x, uint8_t y);
-void ssd1306_draw_string(ssd1306_t *ssd, const char *str, uint8_t x, uint8_t y);
\ No newline at end of file
+void ssd1306_draw_string(ssd1306_t *ssd, const char *str, uint8_t x, uint8_t y);
+void ssd1306_draw_char_mode(ssd1306_t *ssd, char c, uint8_t x, uint8_t y, ssd1306_text_mode_t mode);
+uint16_t ssd1306_measure_string(const char *str);
+uint16_t ssd1306_draw_string_clipped(ssd1306_t *ssd, const char *str, uint8_t x, uint8_t y, uint8_t max_width, ssd1306_text_mode_t mode);
+
+#endif // SSD1306_H
@@ -0,0 +1,174 @@
+#include "ssd1306.h"
+#include "hardware/dma.h"
+#include "hardware/irq.h"
+#include "hardware/sync.h"
+
+// Transporte bloqueante: cada transação via i2c_write_blocking
+static void ssd1306_i2c_write(void *ctx, uint8_t address, const uint8_t *src, size_t len) {
+  i2c_write_blocking((i2c_inst_t *)ctx, address, src, len, false);
+}
+
+void ssd1306_i2c_transport(ssd1306_transport_t *transport, i2c_inst_t *i2c) {
+  transport->write = ssd1306_i2c_write;
+  transport->write_async = NULL;
+  transport->prepare = NULL;
+  transport->abort = NULL;
+  transport->ctx = i2c;
+}
+
+// Transporte por DMA: o quadro é convertido uma vez, fora de interrupção
+// (prepare), em palavras de 16 bits para o registrador IC_DATA_CMD; cada
+// transação só marca o STOP na sua última palavra e dispara o canal de DMA,
+// que alimenta a FIFO de transmissão do I2C pelo DREQ. A transação termina na
+// interrupção do I2C: STOP_DET quando o último byte saiu no barramento,
+// TX_ABRT quando o painel não confirmou (NACK). Um alarme limita cada
+// transação, então done sempre é chamado. Só há um display, então o estado
+// fica em uma única estrutura estática.
+#define SSD1306_I2C_TIMEOUT_US 50000
+
+static struct {
+  i2c_inst_t *i2c;
+  int channel;
+  uint16_t words[SSD1306_TX_MAX];
+  const uint8_t *prepared;
+  size_t prepared_len;
+  alarm_id_t alarm;
+  ssd1306_done_cb_t done;
+  void *arg;
+} dma_state;
+
+// Retira a transação em andamento; só quem a retirou chama done, então a
+// interrupção do I2C e o alarme não a encerram duas vezes
+static ssd1306_done_cb_t ssd1306_i2c_dma_take(void) {
+  uint32_t irq = save_and_disable_interrupts();
+  ssd1306_done_cb_t done = dma_state.done;
+  dma_state.done = NULL;
+  restore_interrupts(irq);
+  if (done) {
+    i2c_get_hw(dma_state.i2c)->intr_mask = 0;
+    if (dma_state.alarm > 0)
+      cancel_alarm(dma_state.alarm);
+    dma_state.alarm = 0;
+  }
+  return done;
+}
+
+// Para o DMA e aborta a transferência no controlador, que descarta a FIFO e
+// gera o STOP
+static void ssd1306_i2c_dma_stop(void) {
+  i2c_hw_t *hw = i2c_get_hw(dma_state.i2c);
+  dma_channel_abort(dma_state.channel);
+  hw->enable |= I2C_IC_ENABLE_ABORT_BITS;
+}
+
+static void ssd1306_i2c_irq(void) {
+  i2c_hw_t *hw = i2c_get_hw(dma_state.i2c);
+  uint32_t status = hw->intr_stat;
+  bool ok;
+  if (status & I2C_IC_INTR_STAT_R_TX_ABRT_BITS) {
+    // A FIFO fica descartada até a leitura de IC_CLR_TX_ABRT: o DMA para antes
+    dma_channel_abort(dma_state.channel);
+    (void)hw->clr_tx_abrt;
+    (void)hw->clr_stop_det;
+    ok = false;
+  } else if (status & I2C_IC_INTR_STAT_R_STOP_DET_BITS) {
+    (void)hw->clr_stop_det;
+    ok = true;
+  } else {
+    return;
+  }
+  ssd1306_done_cb_t done = ssd1306_i2c_dma_take();
+  if (done)
+    done(dma_state.arg, ok);
+}
+
+static int64_t ssd1306_i2c_dma_timeout(alarm_id_t id, void *arg) {
+  (void)id;
+  (void)arg;
+  dma_state.alarm = 0;
+  ssd1306_done_cb_t done = ssd1306_i2c_dma_take();
+  if (done) {
+    ssd1306_i2c_dma_stop();
+    done(dma_state.arg, false);
+  }
+  return 0;
+}
+
+// Espera a FIFO esvaziar e o barramento ficar ocioso
+static void ssd1306_i2c_dma_wait_idle(void) {
+  i2c_hw_t *hw = i2c_get_hw(dma_state.i2c);
+  while (dma_channel_is_busy(dma_state.channel))
+    tight_loop_contents();
+  while (!(hw->status & I2C_IC_STATUS_TFE_BITS) || (hw->status & I2C_IC_STATUS_MST_ACTIVITY_BITS))
+    tight_loop_contents();
+}
+
+static void ssd1306_i2c_dma_write(void *ctx, uint8_t address, const uint8_t *src, size_t len) {
+  ssd1306_i2c_dma_wait_idle();
+  i2c_write_blocking((i2c_inst_t *)ctx, address, src, len, false);
+}
+
+static void ssd1306_i2c_dma_prepare(void *ctx, const uint8_t *src, size_t len) {
+  (void)ctx;
+  for (size_t i = 0; i < len; ++i)
+    dma_state.words[i] = src[i];
+  dma_state.prepared = src;
+  dma_state.prepared_len = len;
+}
+
+static void ssd1306_i2c_dma_write_async(void *ctx, uint8_t address, const uint8_t *src, size_t len, ssd1306_done_cb_t done, void *arg) {
+  i2c_hw_t *hw = i2c_get_hw((i2c_inst_t *)ctx);
+  if ((hw->tar & I2C_IC_TAR_IC_TAR_BITS) != address) {
+    ssd1306_i2c_dma_wait_idle();
+    hw->enable = 0;
+    hw->tar = address;
+    hw->enable = 1;
+  }
+  // Bytes que não vieram de prepare são convertidos aqui
+  if (src < dma_state.prepared || src + len > dma_state.prepared + dma_state.prepared_len)
+    ssd1306_i2c_dma_prepare(ctx, src, len);
+  uint16_t *words = dma_state.words + (src - dma_state.prepared);
+  words[len - 1] |= I2C_IC_DATA_CMD_STOP_BITS;
+
+  (void)hw->clr_stop_det;
+  (void)hw->clr_tx_abrt;
+  dma_state.done = done;
+  dma_state.arg = arg;
+  dma_state.alarm = add_alarm_in_us(SSD1306_I2C_TIMEOUT_US, ssd1306_i2c_dma_timeout, NULL, true);
+  hw->intr_mask = I2C_IC_INTR_MASK_M_STOP_DET_BITS | I2C_IC_INTR_MASK_M_TX_ABRT_BITS;
+  dma_channel_transfer_from_buffer_now(dma_state.channel, words, len);
+}
+
+static void ssd1306_i2c_dma_abort(void *ctx) {
+  (void)ctx;
+  if (ssd1306_i2c_dma_take())
+    ssd1306_i2c_dma_stop();
+}
+
+void ssd1306_i2c_dma_init(ssd1306_t *ssd) {
+  ssd1306_wait(ssd);
+  dma_state.i2c = ssd->i2c_port;
+  dma_state.channel = dma_claim_unused_channel(true);
+
+  dma_channel_config config = dma_channel_get_default_config(dma_state.channel);
+  channel_config_set_transfer_data_size(&config, DMA_SIZE_16);
+  channel_config_set_read_increment(&config, true);
+  channel_config_set_write_increment(&config, false);
+  channel_config_set_dreq(&config, i2c_get_dreq(ssd->i2c_port, true));
+  dma_channel_configure(dma_state.channel, &config, &i2c_get_hw(ssd->i2c_port)->data_cmd, dma_state.words, 0, false);
+  i2c_get_hw(ssd->i2c_port)->dma_cr = I2C_IC_DMA_CR_TDMAE_BITS;
+
+  i2c_get_hw(ssd->i2c_port)->intr_mask = 0;
+  uint irq = I2C0_IRQ + i2c_hw_index(ssd->i2c_port);
+  irq_set_exclusive_handler(irq, ssd1306_i2c_irq);
+  irq_set_enabled(irq, true);
+
+  ssd1306_transport_t transport = {
+    .write = ssd1306_i2c_dma_write,
+    .write_async = ssd1306_i2c_dma_write_async,
+    .prepare = ssd1306_i2c_dma_prepare,
+    .abort = ssd1306_i2c_dma_abort,
+    .ctx = ssd->i2c_port,
+  };
+  ssd1306_set_transport(ssd, &transport);
+}
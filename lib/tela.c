@@ -0,0 +1,86 @@
+#include "tela.h"
+#include "cena.h"
+#include "digitos.h"
+#include <string.h>
+
+static void adicionar_texto_informativo(ssd1306_t *ssd, const SemaforoEstado *estado) {
+    char linha1[16], linha2[16], linha3[16], linha4[16];
+    memset(linha1, 0, sizeof(linha1));
+    memset(linha2, 0, sizeof(linha2));
+    memset(linha3, 0, sizeof(linha3));
+    memset(linha4, 0, sizeof(linha4));
+
+    int x_pos = 70, y_pos = 0, altura_linha = 10;
+
+    if (estado->modo_noturno) {
+        strcpy(linha1, "NOTURNO AMARELO");
+        strcpy(linha2, "PISCANTE");
+        ssd1306_draw_string(ssd, linha1, x_pos - 70, y_pos);
+        ssd1306_draw_string(ssd, linha2, x_pos - 35, y_pos + altura_linha);
+    } else {
+        switch (estado->estado) {
+            case ESTADO_VERDE:
+                strcpy(linha1, "NORMAL"); strcpy(linha2, "VERDE"); strcpy(linha3, "(SIGA)");
+                break;
+            case ESTADO_AMARELO:
+                strcpy(linha1, "NORMAL"); strcpy(linha2, "AMARELO");
+                break;
+            case ESTADO_VERMELHO:
+                strcpy(linha1, "NORMAL"); strcpy(linha2, "VERMELHO");
+                break;
+        }
+        ssd1306_draw_string(ssd, linha1, x_pos - 10, y_pos);
+        ssd1306_draw_string(ssd, linha2, x_pos - 10, y_pos + altura_linha);
+        ssd1306_draw_string(ssd, linha3, x_pos - 10, y_pos + 2 * altura_linha);
+    }
+}
+
+// Contagem regressiva em dígitos 16x16 no canto inferior direito: limpa a área
+// de dois dígitos e copia um glifo pronto por dígito
+#define CONTAGEM_X(ssd) ((int)(ssd)->width - 2 * (DIGITO_OLED_LARGURA + 2))
+#define CONTAGEM_Y(ssd) ((int)(ssd)->height - DIGITO_OLED_ALTURA)
+
+static void desenhar_contagem_display(ssd1306_t *ssd, uint valor) {
+    ssd1306_rect(ssd, CONTAGEM_Y(ssd), CONTAGEM_X(ssd), ssd->width - CONTAGEM_X(ssd), DIGITO_OLED_ALTURA, false, true);
+    int x = ssd->width - (DIGITO_OLED_LARGURA + 2);
+    do {
+        ssd1306_blit(ssd, digitos_oled[valor % 10], DIGITO_OLED_LARGURA, DIGITO_OLED_ALTURA,
+                     x, CONTAGEM_Y(ssd), SSD1306_ROP_REPLACE);
+        x -= DIGITO_OLED_LARGURA + 2;
+        valor /= 10;
+    } while (valor && x >= CONTAGEM_X(ssd));
+}
+
+static bool mesma_cena(const ChaveCena *a, const ChaveCena *b) {
+    return a->cena == b->cena && a->quadro == b->quadro && a->noturno == b->noturno && a->fase == b->fase &&
+           a->contagem == b->contagem;
+}
+
+bool tela_atualizar(Tela *tela, ssd1306_t *ssd, const SemaforoEstado *estado, uint32_t agora) {
+    Cena escolhida = cena_do_estado(estado);
+    const bitmap_sequence_t *cena = escolhida.seq;
+
+    // Ao trocar de cena ou de texto o quadro base é redesenhado inteiro, senão
+    // só os deltas da animação tocam o buffer
+    const ChaveCena *anterior = &tela->apresentada;
+    bool mesmo_texto = anterior->noturno == estado->modo_noturno && anterior->fase == estado->estado;
+    if (cena != tela->animacao.seq || !mesmo_texto) {
+        animation_start(&tela->animacao, ssd, cena, escolhida.periodo, agora);
+    } else {
+        animation_update(&tela->animacao, ssd, agora);
+        // A contagem acabou no meio da fase (plano atuado): o canto limpo por
+        // ela volta a ser o do quadro atual da cena
+        if (anterior->contagem && !estado->contagem)
+            animation_redraw(&tela->animacao, ssd);
+    }
+
+    ChaveCena chave = {cena, tela->animacao.frame, estado->modo_noturno, estado->estado, estado->contagem};
+    if (mesma_cena(&chave, anterior))
+        return false;
+    adicionar_texto_informativo(ssd, estado);
+    if (estado->contagem) {
+        desenhar_contagem_display(ssd, estado->contagem);
+    }
+    tela->apresentada = chave;
+    return true;
+}
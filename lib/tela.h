@@ -0,0 +1,31 @@
+#ifndef TELA_H
+#define TELA_H
+
+// Composição da tela do display: a cena escolhida pelo estado do semáforo
+// (cena.h), o texto do modo e da fase e a contagem regressiva. Só desenha no
+// buffer; o envio fica com quem chama.
+
+#include "ssd1306.h"
+#include "animation.h"
+#include "semaforo.h"
+
+// O que está na tela: cena, quadro da animação, texto (modo e fase) e
+// contagem. Se não mudou, nada é desenhado nem enviado.
+typedef struct {
+    const bitmap_sequence_t *cena;
+    uint8_t quadro;
+    bool noturno;
+    EstadoSemaforo fase;
+    uint8_t contagem;
+} ChaveCena;
+
+// Começa zerada: o primeiro tela_atualizar desenha a cena inteira
+typedef struct {
+    animation_t animacao;
+    ChaveCena apresentada;
+} Tela;
+
+// Retorna true se o buffer mudou e precisa ser enviado
+bool tela_atualizar(Tela *tela, ssd1306_t *ssd, const SemaforoEstado *estado, uint32_t agora);
+
+#endif // TELA_H
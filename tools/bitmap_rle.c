@@ -0,0 +1,217 @@
+// Gerador dos bitmaps compactados (lib/bitmap_rle.c) a partir dos quadros
+// originais de lib/bitmap.c. Roda no computador, não no Pico:
+//
+//   gcc -Ilib tools/bitmap_rle.c lib/bitmap.c -o bitmap_rle
+//   ./bitmap_rle > lib/bitmap_rle.c
+//
+// Formato (um token por byte de controle, ver ssd1306_draw_rle):
+//   0x00..0x7F  literal: seguem (n + 1) bytes copiados como estão
+//   0x80..0xFF  sequência de (n - 0x7F) bytes zero
+//
+// Também gera as sequências de animação: o primeiro quadro em RLE e, para
+// cada par de quadros consecutivos, um delta com os trechos alterados
+// (ver ssd1306_apply_delta):
+//   página, coluna inicial, quantidade n, n bytes ... terminado por 0xFF
+#include <stdio.h>
+#include <stdint.h>
+#include "bitmap.h"
+
+#define FRAME_SIZE 1024
+
+typedef struct {
+    const char *nome;
+    const unsigned char *quadro;
+} Asset;
+
+static const Asset assets[] = {
+    {"blindOne", epd_bitmap_blindOne},
+    {"blindTwo", epd_bitmap_blindTwo},
+    {"blindThree", epd_bitmap_blindThree},
+    {"sinal", epd_bitmap_sinal},
+    {"sinalPass", epd_bitmap_sinalPass},
+    {"sinalSStop", epd_bitmap_sinalSStop},
+    {"noturnoOne", epd_bitmap_noturnoOne},
+    {"noturnoTwo", epd_bitmap_noturnoTwo},
+    {"startFour", epd_bitmap_startFour},
+    {"startOne", epd_bitmap_startOne},
+    {"startPress", epd_bitmap_startPress},
+    {"startThree", epd_bitmap_startThree},
+    {"startTwo", epd_bitmap_startTwo},
+};
+#define NUM_ASSETS (sizeof(assets) / sizeof(assets[0]))
+
+#define MAX_QUADROS 4
+
+typedef struct {
+    const char *nome;
+    unsigned char num_quadros;
+    unsigned char quadros[MAX_QUADROS];   // índices em assets[]
+} Sequencia;
+
+static const Sequencia sequencias[] = {
+    {"blind", 3, {0, 1, 2}},
+    {"sinalVerde", 2, {3, 4}},
+    {"sinalVermelho", 2, {3, 5}},
+    {"noturno", 2, {6, 7}},
+    {"sinal", 1, {3}},
+    {"blindOne", 1, {0}},
+    {"blindThree", 1, {2}},
+};
+#define NUM_SEQUENCIAS (sizeof(sequencias) / sizeof(sequencias[0]))
+
+// Colunas iguais entre dois trechos alterados até este limite continuam no
+// mesmo trecho; acima disso compensa abrir outro (cabeçalho de 3 bytes)
+#define DELTA_LACUNA 3
+
+static size_t compactar(const unsigned char *src, size_t len, uint8_t *dst) {
+    size_t i = 0, n = 0;
+    while (i < len) {
+        size_t j = i;
+        if (src[i] == 0) {
+            while (j < len && src[j] == 0 && j - i < 128)
+                ++j;
+            dst[n++] = 0x80 + (j - i - 1);
+        } else {
+            // O literal termina antes de dois zeros seguidos, que rendem mais como sequência
+            while (j < len && j - i < 128 && !(src[j] == 0 && j + 1 < len && src[j + 1] == 0))
+                ++j;
+            dst[n++] = j - i - 1;
+            for (size_t k = i; k < j; ++k)
+                dst[n++] = src[k];
+        }
+        i = j;
+    }
+    return n;
+}
+
+static size_t descompactar(const uint8_t *src, uint8_t *dst, size_t len) {
+    size_t n = 0;
+    while (n < len) {
+        uint8_t token = *src++;
+        if (token & 0x80) {
+            for (uint8_t k = 0; k < token - 0x7F; ++k)
+                dst[n++] = 0;
+        } else {
+            for (uint8_t k = 0; k <= token; ++k)
+                dst[n++] = *src++;
+        }
+    }
+    return n;
+}
+
+static size_t gerar_delta(const unsigned char *de, const unsigned char *para, uint8_t *dst) {
+    size_t n = 0;
+    for (int pagina = 0; pagina < 8; ++pagina) {
+        int x = 0;
+        while (x < 128) {
+            if (de[x * 8 + pagina] == para[x * 8 + pagina]) {
+                ++x;
+                continue;
+            }
+            int inicio = x, ultimo = x;
+            for (int y = x + 1; y < 128 && y - ultimo <= DELTA_LACUNA; ++y)
+                if (de[y * 8 + pagina] != para[y * 8 + pagina])
+                    ultimo = y;
+            dst[n++] = pagina;
+            dst[n++] = inicio;
+            dst[n++] = ultimo - inicio + 1;
+            for (int c = inicio; c <= ultimo; ++c)
+                dst[n++] = para[c * 8 + pagina];
+            x = ultimo + 1;
+        }
+    }
+    dst[n++] = 0xFF;
+    return n;
+}
+
+static void aplicar_delta(const uint8_t *delta, uint8_t *quadro) {
+    while (*delta != 0xFF) {
+        uint8_t pagina = *delta++;
+        uint8_t coluna = *delta++;
+        uint8_t n = *delta++;
+        for (uint8_t i = 0; i < n; ++i)
+            quadro[(coluna + i) * 8 + pagina] = *delta++;
+    }
+}
+
+static void imprimir_bytes(const uint8_t *dados, size_t n) {
+    for (size_t i = 0; i < n; ++i)
+        printf("%s0x%02x%s", i % 16 ? " " : "\n\t", dados[i], i + 1 < n ? "," : "");
+    printf("\n};\n");
+}
+
+int main(void) {
+    static uint8_t rle[2 * FRAME_SIZE];
+    uint8_t quadro[FRAME_SIZE];
+    size_t total = 0;
+
+    printf("// Gerado por tools/bitmap_rle.c a partir de lib/bitmap.c. Não editar.\n\n");
+    printf("#include <stddef.h>\n");
+    printf("#include \"bitmap.h\"\n");
+
+    for (size_t a = 0; a < NUM_ASSETS; ++a) {
+        size_t n = compactar(assets[a].quadro, FRAME_SIZE, rle);
+
+        // Confere que a descompactação reproduz o quadro original bit a bit
+        if (descompactar(rle, quadro, FRAME_SIZE) != FRAME_SIZE) {
+            fprintf(stderr, "%s: tamanho incorreto\n", assets[a].nome);
+            return 1;
+        }
+        for (size_t i = 0; i < FRAME_SIZE; ++i) {
+            if (quadro[i] != assets[a].quadro[i]) {
+                fprintf(stderr, "%s: byte %zu diverge\n", assets[a].nome, i);
+                return 1;
+            }
+        }
+
+        printf("\n// '%s', 64x128px, %zu bytes (RLE)\n", assets[a].nome, n);
+        printf("const unsigned char epd_rle_%s [] = {", assets[a].nome);
+        imprimir_bytes(rle, n);
+        total += n;
+    }
+
+    for (size_t s = 0; s < NUM_SEQUENCIAS; ++s) {
+        const Sequencia *seq = &sequencias[s];
+        if (seq->num_quadros < 2)
+            continue;
+        for (int q = 0; q < seq->num_quadros; ++q) {
+            const Asset *de = &assets[seq->quadros[q]];
+            const Asset *para = &assets[seq->quadros[(q + 1) % seq->num_quadros]];
+            size_t n = gerar_delta(de->quadro, para->quadro, rle);
+
+            // Aplicar o delta sobre o quadro anterior deve dar exatamente o próximo
+            for (size_t i = 0; i < FRAME_SIZE; ++i)
+                quadro[i] = de->quadro[i];
+            aplicar_delta(rle, quadro);
+            for (size_t i = 0; i < FRAME_SIZE; ++i) {
+                if (quadro[i] != para->quadro[i]) {
+                    fprintf(stderr, "delta %s -> %s: byte %zu diverge\n", de->nome, para->nome, i);
+                    return 1;
+                }
+            }
+
+            printf("\n// '%s' -> '%s', %zu bytes (delta)\n", de->nome, para->nome, n);
+            printf("static const unsigned char epd_delta_%s_%d [] = {", seq->nome, q);
+            imprimir_bytes(rle, n);
+            total += n;
+        }
+        printf("\nstatic const unsigned char *const epd_deltas_%s[] = {", seq->nome);
+        for (int q = 0; q < seq->num_quadros; ++q)
+            printf("%sepd_delta_%s_%d", q ? ", " : "", seq->nome, q);
+        printf("};\n");
+    }
+
+    printf("\n");
+    for (size_t s = 0; s < NUM_SEQUENCIAS; ++s) {
+        const Sequencia *seq = &sequencias[s];
+        if (seq->num_quadros < 2)
+            printf("const bitmap_sequence_t epd_seq_%s = {epd_rle_%s, NULL, 1};\n",
+                   seq->nome, assets[seq->quadros[0]].nome);
+        else
+            printf("const bitmap_sequence_t epd_seq_%s = {epd_rle_%s, epd_deltas_%s, %d};\n",
+                   seq->nome, assets[seq->quadros[0]].nome, seq->nome, seq->num_quadros);
+    }
+
+    printf("\n// Total de bytes compactados = %zu (original: %d)\n", total, (int)(NUM_ASSETS * FRAME_SIZE));
+    return 0;
+}
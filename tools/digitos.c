@@ -0,0 +1,67 @@
+// Gerador dos glifos de dígitos da contagem regressiva (lib/digitos.c). Roda no
+// computador, não no Pico:
+//
+//   gcc -Ilib tools/digitos.c -o digitos
+//   ./digitos > lib/digitos.c
+//
+// No OLED os dígitos da fonte 8x8 (lib/font.h) são ampliados 2x para 16x16, já
+// no layout de ssd1306_blit. Na matriz cada dígito 3x5 vira uma máscara de 15
+// bits, linha a linha, com o bit 14 no canto superior esquerdo.
+#include <stdio.h>
+#include <stdint.h>
+#include "font.h"
+#include "digitos.h"
+
+static const char *digitos_3x5[10][DIGITO_MATRIZ_ALTURA] = {
+    {"###", "#.#", "#.#", "#.#", "###"},
+    {".#.", "##.", ".#.", ".#.", "###"},
+    {"###", "..#", "###", "#..", "###"},
+    {"###", "..#", "###", "..#", "###"},
+    {"#.#", "#.#", "###", "..#", "..#"},
+    {"###", "#..", "###", "..#", "###"},
+    {"###", "#..", "###", "#.#", "###"},
+    {"###", "..#", ".#.", ".#.", ".#."},
+    {"###", "#.#", "###", "#.#", "###"},
+    {"###", "#.#", "###", "..#", "###"},
+};
+
+// Espalha os bits de um byte: bit i vai para os bits 2i e 2i + 1
+static uint16_t dobrar(uint8_t v) {
+    uint16_t r = 0;
+    for (int i = 0; i < 8; ++i) {
+        if (v & (1 << i))
+            r |= 3u << (2 * i);
+    }
+    return r;
+}
+
+int main(void) {
+    printf("// Gerado por tools/digitos.c a partir de lib/font.h. Não editar.\n\n");
+    printf("#include \"digitos.h\"\n\n");
+
+    printf("const uint8_t digitos_oled[10][DIGITO_OLED_BYTES] = {\n");
+    for (int d = 0; d < 10; ++d) {
+        const uint8_t *glifo = &font[('0' + d - ' ') * 8];
+        printf("\t{");
+        for (int x = 0; x < DIGITO_OLED_LARGURA; ++x) {
+            uint16_t coluna = dobrar(glifo[x / 2]);
+            printf("0x%02x, 0x%02x%s", coluna & 0xFF, coluna >> 8, x < DIGITO_OLED_LARGURA - 1 ? ", " : "");
+        }
+        printf("}, // %d\n", d);
+    }
+    printf("};\n\n");
+
+    printf("const uint16_t digitos_matriz[10] = {\n\t");
+    for (int d = 0; d < 10; ++d) {
+        uint16_t mascara = 0;
+        for (int y = 0; y < DIGITO_MATRIZ_ALTURA; ++y) {
+            for (int x = 0; x < DIGITO_MATRIZ_LARGURA; ++x) {
+                mascara <<= 1;
+                mascara |= digitos_3x5[d][y][x] == '#';
+            }
+        }
+        printf("0x%04x,%s", mascara, d < 9 ? " " : "\n");
+    }
+    printf("};\n");
+    return 0;
+}
@@ -0,0 +1,217 @@
+// Confere o empacotamento das cores e o mapa dos painéis da matriz, mede o
+// custo da conversão de um quadro (gama + brilho + GRB) em matrizes maiores
+// que a 5x5 da placa e mostra pelo modelo de tempo que, com uma cadeia por
+// painel, o quadro leva o tempo da cadeia mais longa e não a soma delas.
+// Roda no computador, não no Pico:
+//
+//   gcc -O2 -DHAL_HOST -DMATRIZ_LARGURA=32 -DMATRIZ_ALTURA=32 -Ilib
+//       tools/matriz_bench.c lib/matriz.c lib/matriz_gama.c -lm -o matriz_bench
+//   ./matriz_bench
+//
+// A conversão por tabela é comparada com o cálculo direto da curva (powf) por
+// canal, que é o que a tabela evita no firmware.
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <time.h>
+#include "matriz.h"
+
+#if MATRIZ_LARGURA < 32 || MATRIZ_ALTURA < 32
+#error "compile com -DMATRIZ_LARGURA=32 -DMATRIZ_ALTURA=32"
+#endif
+
+#define REPETICOES 20000
+#define BRILHO_TESTE 50
+#define FREQ 800000.0f
+
+// matriz.c só usa estas duas funções da HAL
+static uint32_t envios[HAL_LED_STRIPS];
+static size_t envio_tamanho[HAL_LED_STRIPS];
+
+void hal_led_strip_write(uint strip, const uint32_t *pixels, size_t count) {
+    (void)pixels;
+    envios[strip]++;
+    envio_tamanho[strip] = count;
+}
+
+bool hal_led_strip_pronta(uint strip) {
+    (void)strip;
+    return true;
+}
+
+static double agora_ns(void) {
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec * 1e9 + t.tv_nsec;
+}
+
+static int falhas;
+
+static void conferir(const char *nome, uint32_t obtido, uint32_t esperado) {
+    if (obtido != esperado) {
+        printf("FALHA %s: 0x%08x, esperado 0x%08x\n", nome, obtido, esperado);
+        falhas++;
+    }
+}
+
+// O painel 5x5 da placa, uma cadeia
+static const MatrizPainel placa[] = {
+    {.cadeia = 0, .largura = 5, .altura = 5},
+};
+
+// Quatro painéis 16x16 em serpentina formando 32x32, numa só cadeia ou um por cadeia
+static const MatrizPainel uma_cadeia[] = {
+    {.cadeia = 0, .inicio = 0, .x = 0, .y = 0, .largura = 16, .altura = 16, .serpentina = true},
+    {.cadeia = 0, .inicio = 256, .x = 16, .y = 0, .largura = 16, .altura = 16, .serpentina = true},
+    {.cadeia = 0, .inicio = 512, .x = 0, .y = 16, .largura = 16, .altura = 16, .serpentina = true},
+    {.cadeia = 0, .inicio = 768, .x = 16, .y = 16, .largura = 16, .altura = 16, .serpentina = true},
+};
+static const MatrizPainel quatro_cadeias[] = {
+    {.cadeia = 0, .x = 0, .y = 0, .largura = 16, .altura = 16, .serpentina = true},
+    {.cadeia = 1, .x = 16, .y = 0, .largura = 16, .altura = 16, .serpentina = true},
+    {.cadeia = 2, .x = 0, .y = 16, .largura = 16, .altura = 16, .serpentina = true},
+    {.cadeia = 3, .x = 16, .y = 16, .largura = 16, .altura = 16, .serpentina = true},
+};
+static const MatrizPainel duas_cadeias[] = {
+    {.cadeia = 0, .inicio = 0, .x = 0, .y = 0, .largura = 16, .altura = 16, .serpentina = true},
+    {.cadeia = 0, .inicio = 256, .x = 16, .y = 0, .largura = 16, .altura = 16, .serpentina = true},
+    {.cadeia = 1, .inicio = 0, .x = 0, .y = 16, .largura = 16, .altura = 16, .serpentina = true},
+    {.cadeia = 1, .inicio = 256, .x = 16, .y = 16, .largura = 16, .altura = 16, .serpentina = true},
+};
+static const MatrizPainel painel_16x16[] = {
+    {.cadeia = 0, .largura = 16, .altura = 16, .serpentina = true},
+};
+
+#define NUM(v) (sizeof(v) / sizeof((v)[0]))
+
+static Matriz m;
+
+static void conferir_empacotamento(void) {
+    matriz_init(&m, placa, NUM(placa), 255);
+
+    // Brilho máximo: canais saturados passam inalterados, na ordem G, R, B
+    matriz_pixel(&m, 0, 0, matriz_rgb(255, 0, 0));
+    matriz_pixel(&m, 1, 0, matriz_rgb(0, 255, 0));
+    matriz_pixel(&m, 2, 0, matriz_rgb(0, 0, 255));
+    matriz_pixel(&m, 3, 0, matriz_rgb(255, 255, 255));
+    matriz_pixel(&m, 5, 0, matriz_rgb(255, 255, 255));   // fora do painel, dentro da área
+    matriz_mostrar(&m);
+    conferir("vermelho", m.enviado[0], 0x00FF0000);
+    conferir("verde", m.enviado[1], 0xFF000000);
+    conferir("azul", m.enviado[2], 0x0000FF00);
+    conferir("branco", m.enviado[3], 0xFFFFFF00);
+    conferir("apagado", m.enviado[4], 0);
+    conferir("fora do painel", m.enviado[5], 0);
+
+    // Brilho 50 reproduz os níveis fixos do firmware antigo
+    matriz_brilho(&m, 50);
+    matriz_mostrar(&m);
+    conferir("brilho 50", m.enviado[0], 50u << 16);
+    conferir("quadros enviados", m.quadros_enviados, 2);
+
+    // Nada mudou: o quadro não é reenviado
+    matriz_mostrar(&m);
+    conferir("quadros iguais", m.quadros_iguais, 1);
+
+    // Meio-tom: a curva gama, não metade da intensidade
+    matriz_brilho(&m, 255);
+    matriz_pixel(&m, 0, 0, matriz_rgb(128, 0, 0));
+    matriz_mostrar(&m);
+    conferir("gama", m.enviado[0], (uint32_t)matriz_gama[128] << 16);
+}
+
+static void conferir_mapa(void) {
+    conferir("init", matriz_init(&m, quatro_cadeias, NUM(quatro_cadeias), 255), true);
+    conferir("cadeias", m.num_cadeias, 4);
+
+    // Serpentina: o LED 16 começa a segunda linha pela direita
+    matriz_pixel(&m, 15, 1, matriz_rgb(0, 0, 255));
+    // Painel de baixo à direita: cadeia 3, LED 0
+    matriz_pixel(&m, 16, 16, matriz_rgb(255, 0, 0));
+    for (uint c = 0; c < HAL_LED_STRIPS; ++c)
+        envios[c] = 0;
+    matriz_mostrar(&m);
+    conferir("serpentina", m.enviado[16], 0x0000FF00);
+    conferir("painel 3", m.enviado[m.cadeia_inicio[3]], 0x00FF0000);
+    conferir("tamanho cadeia", envio_tamanho[3], 256);
+
+    // Só a cadeia que mudou é retransmitida
+    matriz_pixel(&m, 16, 0, matriz_rgb(0, 255, 0));
+    matriz_mostrar(&m);
+    conferir("envios cadeia 0", envios[0], 1);
+    conferir("envios cadeia 1", envios[1], 2);
+
+    static const MatrizPainel fora[] = {{.cadeia = 0, .x = 20, .largura = 16, .altura = 16}};
+    conferir("painel fora", matriz_init(&m, fora, NUM(fora), 255), false);
+}
+
+static void modelo_tempo(void) {
+    struct {
+        const char *nome;
+        const MatrizPainel *paineis;
+        uint num;
+    } casos[] = {
+        {"4x16x16, 1 cadeia", uma_cadeia, NUM(uma_cadeia)},
+        {"4x16x16, 2 cadeias", duas_cadeias, NUM(duas_cadeias)},
+        {"4x16x16, 4 cadeias", quatro_cadeias, NUM(quatro_cadeias)},
+    };
+    printf("\nmodelo de tempo a %.0f kHz (paralelo = maior cadeia, serial = soma):\n", FREQ / 1000);
+    for (uint i = 0; i < NUM(casos); ++i) {
+        matriz_init(&m, casos[i].paineis, casos[i].num, 255);
+        uint32_t paralelo = matriz_tempo_quadro_us(&m, FREQ, false);
+        uint32_t serial = 0;
+        for (uint c = 0; c < m.num_cadeias; ++c)
+            serial += (uint32_t)(m.cadeia_tamanho[c] * 24 * 1000000.0f / FREQ) + 60;
+        printf("  %-20s %8.2f ms paralelo, %8.2f ms serial\n", casos[i].nome, paralelo / 1000.0, serial / 1000.0);
+    }
+}
+
+static void converter_direto(uint8_t brilho, const uint32_t *rgb, uint32_t *saida, size_t n) {
+    for (size_t i = 0; i < n; ++i) {
+        uint32_t canal[3];
+        for (int c = 0; c < 3; ++c) {
+            float v = ((rgb[i] >> (16 - 8 * c)) & 0xFF) / 255.0f;
+            canal[c] = (uint32_t)(powf(v, 2.8f) * brilho + 0.5f);
+        }
+        saida[i] = (canal[1] << 24) | (canal[0] << 16) | (canal[2] << 8);
+    }
+}
+
+static void medir(const char *nome, const MatrizPainel *paineis, uint num) {
+    static uint32_t saida[MATRIZ_PIXELS];
+    matriz_init(&m, paineis, num, BRILHO_TESTE);
+    for (size_t i = 0; i < MATRIZ_PIXELS; ++i)
+        m.quadro[i] = (uint32_t)rand() & 0xFFFFFF;
+    uint n = 0;
+    for (uint c = 0; c < m.num_cadeias; ++c)
+        n += m.cadeia_tamanho[c];
+
+    // Sem mudanças, matriz_mostrar ainda converte o quadro inteiro
+    double t0 = agora_ns();
+    for (int r = 0; r < REPETICOES; ++r)
+        matriz_mostrar(&m);
+    double t1 = agora_ns();
+    for (int r = 0; r < REPETICOES / 20; ++r)
+        converter_direto(BRILHO_TESTE, m.quadro, saida, n);
+    double t2 = agora_ns();
+
+    double tabela = (t1 - t0) / REPETICOES, direto = (t2 - t1) / (REPETICOES / 20);
+    printf("  %-20s %4u pixels: tabela %8.1f ns/quadro (%5.2f ns/pixel), powf %9.1f ns/quadro (%.0fx)\n",
+           nome, n, tabela, tabela / n, direto, direto / tabela);
+}
+
+int main(void) {
+    conferir_empacotamento();
+    conferir_mapa();
+    if (falhas)
+        return 1;
+    printf("empacotamento GRB e mapa dos painéis ok\n");
+
+    modelo_tempo();
+
+    printf("\nconversão por quadro:\n");
+    medir("5x5", placa, NUM(placa));
+    medir("16x16", painel_16x16, NUM(painel_16x16));
+    medir("4x16x16, 4 cadeias", quatro_cadeias, NUM(quatro_cadeias));
+    return 0;
+}
@@ -0,0 +1,25 @@
+// Gerador da tabela de correção gama da matriz WS2812 (lib/matriz_gama.c).
+// Roda no computador, não no Pico:
+//
+//   gcc tools/matriz_gama.c -lm -o matriz_gama
+//   ./matriz_gama > lib/matriz_gama.c
+//
+// O LED responde de forma linear ao valor do canal, mas o olho não: com a
+// curva v^GAMA os níveis intermediários parecem igualmente espaçados.
+#include <stdio.h>
+#include <math.h>
+
+#define GAMA 2.8
+
+int main(void) {
+    printf("// Gerado por tools/matriz_gama.c (gama %.1f). Não editar.\n\n", GAMA);
+    printf("#include \"matriz.h\"\n\n");
+    printf("const uint8_t matriz_gama[256] = {\n");
+    for (int i = 0; i < 256; ++i) {
+        if (i % 16 == 0)
+            printf("\t");
+        printf("%3d,%s", (int)(pow(i / 255.0, GAMA) * 255.0 + 0.5), i % 16 == 15 ? "\n" : " ");
+    }
+    printf("};\n");
+    return 0;
+}
@@ -0,0 +1,422 @@
+// Procura ciclo, divisão do verde e defasagens de um corredor para que os
+// carros da via principal peguem uma onda verde, avaliando cada candidato com
+// os próprios controladores de lib/semaforo.c no plano coordenado. Imprime as
+// definições de compilação de cada placa (COORDENADO_* e DEFASAGEM_CRUZAMENTO).
+// Roda no computador, não no Pico:
+//
+//   gcc -O2 -DHAL_HOST -Ilib -Ihost tools/onda_verde.c host/trafego.c lib/semaforo.c -lm -pthread
+//       -o onda_verde
+//   ./onda_verde [-j threads] tools/corredor.txt
+//
+// O formato do corredor está em tools/corredor.txt. Os carros da via seguem de
+// cruzamento em cruzamento no tempo de percurso de cada trecho; os da
+// transversal só atravessam. Em cada cruzamento um carro parado sai
+// PERDA_PARTIDA depois da abertura e os seguintes a cada INTERVALO_SAIDA. As
+// chegadas são sorteadas uma vez, então todos os candidatos veem os mesmos
+// carros. O objetivo é o atraso médio por carro, somando todas as paradas.
+//
+// A busca tem duas etapas: uma grade de ciclo x verde com as defasagens da
+// onda ideal (tempo de percurso acumulado) e, nos melhores pontos da grade,
+// descida coordenada nas defasagens, um cruzamento por vez. Cada lote de
+// candidatos é avaliado em paralelo; resultados repetidos vêm do cache.
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <unistd.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include "semaforo.h"
+#include "trafego.h"
+
+#define MAX_CRUZAMENTOS 16
+#define HORIZONTE 1800000u      // 30 min de chegadas
+#define FOLGA 600000u           // para a fila final escoar
+#define CICLO_MIN 40000
+#define CICLO_MAX 120000
+#define CICLO_PASSO 10000
+#define VERDE_PASSO 0.1
+#define VERMELHO_MINIMO 5000
+#define DEFASAGEM_PASSO 2000
+#define MELHORES_GRADE 3
+#define MAX_VOLTAS 3
+#define MAX_CARROS 8192
+#define MAX_LOTE 256
+#define TAMANHO_CACHE 65536     // potência de 2
+
+typedef struct {
+    uint32_t distancia;         // m desde o anterior
+    double velocidade;          // km/h
+    double transversal;         // carros/min
+    uint32_t percurso;          // ms desde o anterior
+    uint32_t *chegadas_transversal;
+    uint n_transversal;
+} Cruzamento;
+
+typedef struct {
+    uint n;
+    double demanda;
+    Cruzamento cruzamentos[MAX_CRUZAMENTOS];
+    uint32_t *chegadas;         // na via, antes do primeiro cruzamento
+    uint n_chegadas;
+} Corredor;
+
+typedef struct {
+    uint32_t ciclo, verde;
+    uint32_t defasagens[MAX_CRUZAMENTOS];
+} Candidato;
+
+typedef struct {
+    uint32_t inicio, fim;
+} Intervalo;
+
+#define MAX_VERDES (2 * (HORIZONTE + FOLGA) / CICLO_MIN + 4)
+
+// Verdes registrados pelas saídas injetadas durante uma avaliação
+typedef struct {
+    uint32_t agora;
+    Intervalo via[MAX_VERDES], transversal[MAX_VERDES];
+    uint n_via, n_transversal;
+} Gravacao;
+
+static Corredor corredor;
+
+// As mesmas chegadas em toda execução
+static uint64_t semente = SEMENTE_TRAFEGO;
+
+static uint sortear_chegadas(double carros_min, uint32_t **chegadas) {
+    *chegadas = malloc(MAX_CARROS * sizeof(uint32_t));
+    double taxa = carros_min / 60000.0;
+    uint n = 0;
+    double t = 0;
+    while (taxa > 0 && n < MAX_CARROS) {
+        t += tempo_chegada(&semente, taxa);
+        if (t >= HORIZONTE)
+            break;
+        (*chegadas)[n++] = (uint32_t)t;
+    }
+    return n;
+}
+
+static bool ler_corredor(const char *caminho) {
+    FILE *f = fopen(caminho, "r");
+    if (!f) {
+        perror(caminho);
+        return false;
+    }
+    char linha[256];
+    while (fgets(linha, sizeof(linha), f)) {
+        char *comentario = strchr(linha, '#');
+        if (comentario)
+            *comentario = 0;
+        Cruzamento *c = &corredor.cruzamentos[corredor.n];
+        if (sscanf(linha, " demanda %lf", &corredor.demanda) == 1)
+            continue;
+        if (sscanf(linha, " cruzamento %u %lf %lf", &c->distancia, &c->velocidade, &c->transversal) == 3) {
+            if (corredor.n == MAX_CRUZAMENTOS || c->velocidade <= 0) {
+                fprintf(stderr, "%s: cruzamento inválido ou além de %d\n", caminho, MAX_CRUZAMENTOS);
+                fclose(f);
+                return false;
+            }
+            c->percurso = (uint32_t)(c->distancia / (c->velocidade / 3.6) * 1000);
+            corredor.n++;
+        }
+    }
+    fclose(f);
+    if (!corredor.n) {
+        fprintf(stderr, "%s: nenhum cruzamento\n", caminho);
+        return false;
+    }
+    corredor.n_chegadas = sortear_chegadas(corredor.demanda, &corredor.chegadas);
+    for (uint i = 0; i < corredor.n; ++i) {
+        Cruzamento *c = &corredor.cruzamentos[i];
+        c->n_transversal = sortear_chegadas(c->transversal, &c->chegadas_transversal);
+    }
+    return true;
+}
+
+static void gravar_luz(void *ctx, uint id, Luz luz, bool acesa) {
+    Gravacao *g = ctx;
+    Intervalo *v = luz == LUZ_VERDE ? g->via : luz == LUZ_VERMELHA ? g->transversal : NULL;
+    uint *n = luz == LUZ_VERDE ? &g->n_via : &g->n_transversal;
+    if (!v)
+        return;
+    if (acesa && *n < MAX_VERDES)
+        v[(*n)++] = (Intervalo){g->agora, UINT32_MAX};
+    else if (!acesa && *n && v[*n - 1].fim == UINT32_MAX)
+        v[*n - 1].fim = g->agora;
+}
+
+static void buzzer_mudo(void *ctx, uint id, uint freq) {
+}
+
+// Passa os carros (chegadas em ordem) pelos verdes; grava as saídas se pedido
+// e retorna a soma dos atrasos em ms
+static double atender(const Intervalo *verdes, uint n_verdes, const uint32_t *chegadas, uint n, uint32_t *saidas) {
+    double atraso = 0;
+    uint32_t ultima = 0;
+    uint v = 0;
+    for (uint i = 0; i < n; ++i) {
+        uint32_t t = chegadas[i];
+        if (i > 0 && t < ultima + INTERVALO_SAIDA)
+            t = ultima + INTERVALO_SAIDA;
+        while (v < n_verdes) {
+            if (t < verdes[v].inicio)
+                t = verdes[v].inicio + PERDA_PARTIDA;
+            if (t < verdes[v].fim)
+                break;
+            v++;
+        }
+        // Sem verde até o fim da simulação: conta a espera até lá
+        if (v == n_verdes && t < HORIZONTE + FOLGA)
+            t = HORIZONTE + FOLGA;
+        atraso += t - chegadas[i];
+        if (saidas)
+            saidas[i] = t;
+        ultima = t;
+    }
+    return atraso;
+}
+
+// Atraso médio por carro (s) de um candidato
+static double avaliar(const Candidato *c) {
+    PlanoTempo plano = planos[PLANO_COORDENADO];
+    plano.fases[0].duracao = c->verde;
+    plano.fases[2].duracao = c->ciclo - c->verde - plano.fases[1].duracao;
+
+    Gravacao *g = malloc(sizeof(Gravacao));
+    uint32_t *chegadas = malloc(MAX_CARROS * sizeof(uint32_t));
+    uint32_t *saidas = malloc(MAX_CARROS * sizeof(uint32_t));
+    memcpy(chegadas, corredor.chegadas, corredor.n_chegadas * sizeof(uint32_t));
+    SaidasSemaforo gravar = {gravar_luz, buzzer_mudo, NULL, g};
+    double atraso = 0;
+    uint64_t carros = 0;
+
+    for (uint i = 0; i < corredor.n; ++i) {
+        const Cruzamento *k = &corredor.cruzamentos[i];
+        Semaforo s;
+        semaforo_init(&s, &gravar, i);
+        semaforo_coordenar(&s, &plano, c->defasagens[i]);
+        semaforo_selecionar_plano(&s, PLANO_COORDENADO);
+        g->n_via = g->n_transversal = 0;
+        for (g->agora = 0; g->agora < HORIZONTE + FOLGA;) {
+            uint32_t espera = semaforo_passo(&s, g->agora);
+            g->agora += espera ? espera : 1;
+        }
+
+        // O pelotão chega percorrido o trecho
+        for (uint j = 0; j < corredor.n_chegadas; ++j)
+            chegadas[j] = (i ? saidas[j] : chegadas[j]) + k->percurso;
+        atraso += atender(g->via, g->n_via, chegadas, corredor.n_chegadas, saidas);
+        atraso += atender(g->transversal, g->n_transversal, k->chegadas_transversal, k->n_transversal, NULL);
+        carros += corredor.n_chegadas + k->n_transversal;
+    }
+    free(g);
+    free(chegadas);
+    free(saidas);
+    return carros ? atraso / 1000.0 / carros : 0;
+}
+
+// Cache dos candidatos já avaliados, endereçamento aberto; só a thread
+// principal o acessa
+typedef struct {
+    bool usado;
+    Candidato candidato;
+    double atraso;
+} Entrada;
+
+static Entrada cache[TAMANHO_CACHE];
+static uint64_t avaliacoes, acertos;
+
+static uint32_t espalhar(const Candidato *c) {
+    uint64_t h = 1469598103934665603ull;
+    const uint8_t *p = (const uint8_t *)c;
+    for (size_t i = 0; i < sizeof(*c); ++i)
+        h = (h ^ p[i]) * 1099511628211ull;
+    return (uint32_t)(h ^ (h >> 32));
+}
+
+static Entrada *procurar(const Candidato *c) {
+    uint32_t i = espalhar(c) & (TAMANHO_CACHE - 1);
+    while (cache[i].usado && memcmp(&cache[i].candidato, c, sizeof(*c)) != 0)
+        i = (i + 1) & (TAMANHO_CACHE - 1);
+    return &cache[i];
+}
+
+typedef struct {
+    const Candidato *candidatos[MAX_LOTE];
+    double atrasos[MAX_LOTE];
+    uint n;
+    atomic_uint proximo;
+} Lote;
+
+static void *trabalhar(void *arg) {
+    Lote *l = arg;
+    uint i;
+    while ((i = atomic_fetch_add(&l->proximo, 1)) < l->n)
+        l->atrasos[i] = avaliar(l->candidatos[i]);
+    return NULL;
+}
+
+static uint num_threads = 1;
+
+// Avalia n candidatos em paralelo (os que não estão no cache) e grava os atrasos
+static void avaliar_lote(const Candidato *candidatos, uint n, double *atrasos) {
+    static Lote lote;
+    lote.n = 0;
+    atomic_store(&lote.proximo, 0);
+    for (uint i = 0; i < n; ++i) {
+        Entrada *e = procurar(&candidatos[i]);
+        if (e->usado)
+            continue;
+        // Marca já, para que repetidos no mesmo lote não sejam avaliados duas vezes
+        if (avaliacoes + lote.n >= TAMANHO_CACHE / 2) {
+            fprintf(stderr, "cache cheio\n");
+            exit(1);
+        }
+        e->usado = true;
+        e->candidato = candidatos[i];
+        e->atraso = NAN;
+        lote.candidatos[lote.n++] = &candidatos[i];
+    }
+
+    pthread_t threads[num_threads];
+    for (uint t = 1; t < num_threads; ++t)
+        pthread_create(&threads[t], NULL, trabalhar, &lote);
+    trabalhar(&lote);
+    for (uint t = 1; t < num_threads; ++t)
+        pthread_join(threads[t], NULL);
+
+    for (uint i = 0; i < lote.n; ++i)
+        procurar(lote.candidatos[i])->atraso = lote.atrasos[i];
+    avaliacoes += lote.n;
+    acertos += n - lote.n;
+    for (uint i = 0; i < n; ++i)
+        atrasos[i] = procurar(&candidatos[i])->atraso;
+}
+
+// Defasagens da onda ideal: cada cruzamento abre quando o pelotão do anterior chega
+static void onda_ideal(Candidato *c) {
+    uint32_t acumulado = 0;
+    for (uint i = 0; i < corredor.n; ++i) {
+        acumulado += i ? corredor.cruzamentos[i].percurso : 0;
+        c->defasagens[i] = acumulado % c->ciclo;
+    }
+}
+
+// Descida coordenada: cada defasagem (a do primeiro fica em 0) percorre o
+// ciclo em DEFASAGEM_PASSO com as outras fixas, até uma volta sem melhora
+static double descer(Candidato *melhor) {
+    static Candidato lote[MAX_LOTE];
+    static double atrasos[MAX_LOTE];
+    double atraso;
+    avaliar_lote(melhor, 1, &atraso);
+    for (int volta = 0; volta < MAX_VOLTAS; ++volta) {
+        bool melhorou = false;
+        for (uint i = 1; i < corredor.n; ++i) {
+            uint n = 0;
+            for (uint32_t d = 0; d < melhor->ciclo && n < MAX_LOTE; d += DEFASAGEM_PASSO) {
+                lote[n] = *melhor;
+                lote[n++].defasagens[i] = d;
+            }
+            avaliar_lote(lote, n, atrasos);
+            for (uint j = 0; j < n; ++j) {
+                if (atrasos[j] < atraso - 1e-9) {
+                    atraso = atrasos[j];
+                    *melhor = lote[j];
+                    melhorou = true;
+                }
+            }
+        }
+        if (!melhorou)
+            break;
+    }
+    return atraso;
+}
+
+int main(int argc, char **argv) {
+    long nucleos = sysconf(_SC_NPROCESSORS_ONLN);
+    num_threads = nucleos > 0 ? (uint)nucleos : 1;
+    int opt;
+    while ((opt = getopt(argc, argv, "j:")) != -1) {
+        if (opt == 'j' && atoi(optarg) > 0) {
+            num_threads = atoi(optarg);
+        } else {
+            fprintf(stderr, "uso: %s [-j threads] corredor.txt\n", argv[0]);
+            return 1;
+        }
+    }
+    if (optind >= argc || !ler_corredor(argv[optind])) {
+        fprintf(stderr, "uso: %s [-j threads] corredor.txt\n", argv[0]);
+        return 1;
+    }
+    uint32_t amarelo = planos[PLANO_COORDENADO].fases[1].duracao;
+
+    // Referência: os tempos padrão do plano coordenado sem defasagens, como
+    // placas ligadas juntas sem coordenação
+    Candidato padrao = {.ciclo = COORDENADO_VERDE + COORDENADO_AMARELO + COORDENADO_VERMELHO,
+                        .verde = COORDENADO_VERDE};
+    double atraso_padrao;
+    avaliar_lote(&padrao, 1, &atraso_padrao);
+
+    // Etapa 1: grade de ciclo x verde com a onda ideal
+    static Candidato grade[MAX_LOTE];
+    static double atrasos[MAX_LOTE];
+    uint n = 0;
+    for (uint32_t ciclo = CICLO_MIN; ciclo <= CICLO_MAX; ciclo += CICLO_PASSO) {
+        for (double fracao = 0.3; fracao < 0.85; fracao += VERDE_PASSO) {
+            uint32_t verde = (uint32_t)((ciclo - amarelo) * fracao) / 1000 * 1000;
+            uint32_t vermelho = ciclo - amarelo - verde;
+            if (verde < COORDENADO_VERDE_MINIMO || vermelho < VERMELHO_MINIMO || verde > UINT16_MAX ||
+                vermelho > UINT16_MAX || n == MAX_LOTE)
+                continue;
+            grade[n] = (Candidato){.ciclo = ciclo, .verde = verde};
+            onda_ideal(&grade[n++]);
+        }
+    }
+    avaliar_lote(grade, n, atrasos);
+
+    // Etapa 2: descida nas defasagens dos melhores pontos da grade
+    Candidato melhor = grade[0];
+    double atraso_melhor = INFINITY;
+    for (int m = 0; m < MELHORES_GRADE && m < (int)n; ++m) {
+        uint escolhido = m;
+        for (uint i = m + 1; i < n; ++i) {
+            if (atrasos[i] < atrasos[escolhido])
+                escolhido = i;
+        }
+        Candidato c = grade[escolhido];
+        double a = atrasos[escolhido];
+        grade[escolhido] = grade[m];
+        atrasos[escolhido] = atrasos[m];
+        grade[m] = c;
+        atrasos[m] = a;
+
+        double atraso = descer(&c);
+        printf("ciclo %3u s, verde %2u s: onda ideal %5.1f s, após a descida %5.1f s\n", c.ciclo / 1000,
+               c.verde / 1000, a, atraso);
+        if (atraso < atraso_melhor) {
+            atraso_melhor = atraso;
+            melhor = c;
+        }
+    }
+
+    // Os mesmos tempos com todos os ciclos começando juntos
+    Candidato sem_defasagem = {.ciclo = melhor.ciclo, .verde = melhor.verde};
+    double atraso_sem_defasagem;
+    avaliar_lote(&sem_defasagem, 1, &atraso_sem_defasagem);
+
+    uint32_t vermelho = melhor.ciclo - melhor.verde - amarelo;
+    printf("\n%u cruzamentos, %.0f carros/min na via; %llu avaliações, %llu do cache, %u threads\n", corredor.n,
+           corredor.demanda, (unsigned long long)avaliacoes, (unsigned long long)acertos, num_threads);
+    printf("atraso médio por carro: %.1f s no plano coordenado padrão sem defasagens, %.1f s com os tempos\n"
+           "escolhidos sem defasagens, %.1f s com a onda verde\n",
+           atraso_padrao, atraso_sem_defasagem, atraso_melhor);
+    printf("ciclo %u ms: verde %u, amarelo %u, vermelho %u\n", melhor.ciclo, melhor.verde, amarelo, vermelho);
+    for (uint i = 0; i < corredor.n; ++i) {
+        printf("cruzamento %u: -DPLANO_INICIAL=PLANO_COORDENADO -DCOORDENADO_VERDE=%u -DCOORDENADO_AMARELO=%u "
+               "-DCOORDENADO_VERMELHO=%u -DDEFASAGEM_CRUZAMENTO=%u\n",
+               i, melhor.verde, amarelo, vermelho, melhor.defasagens[i]);
+    }
+    return 0;
+}
@@ -0,0 +1,168 @@
+// Mede quantos passos de semáforo por segundo o host aguenta com N
+// cruzamentos independentes no mesmo processo, nas duas arrumações:
+//
+// - objetos: um Semaforo por cruzamento (estado, seqlock e saídas juntos), com
+//   o prazo ao lado; a varredura atravessa ~130 bytes por cruzamento;
+// - lote: SemaforoLote, com os prazos num vetor contíguo separado dos estados;
+//   a varredura lê 4 bytes por cruzamento e só toca quem avança.
+//
+// Os cruzamentos rodam o plano atuado com sensores pseudoaleatórios e
+// começam defasados em múltiplos de 10 ms, então todos os prazos caem numa
+// grade de 10 ms. As duas arrumações têm de produzir as mesmas saídas.
+// Roda no computador, não no Pico:
+//
+//   gcc -O2 -DHAL_HOST -Ilib tools/semaforo_bench.c lib/semaforo.c -o semaforo_bench
+//   ./semaforo_bench [N máximo]
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "semaforo.h"
+
+#define N_PADRAO 100000
+// Instâncias x segundos simulados de cada medida; N pequeno roda mais tempo
+#define ORCAMENTO 2000000.0
+#define SEGUNDOS_MIN 20.0
+#define SEGUNDOS_MAX 600.0
+#define DEFASAGEM_MAX 12000
+
+typedef struct {
+    uint64_t trocas_luz;
+    uint64_t trocas_buzzer;
+    uint64_t leituras;
+    uint32_t agora;
+} Contadores;
+
+static void luz_conta(void *ctx, uint id, Luz luz, bool acesa) {
+    ((Contadores *)ctx)->trocas_luz += acesa;
+}
+
+static void buzzer_conta(void *ctx, uint id, uint freq) {
+    ((Contadores *)ctx)->trocas_buzzer++;
+}
+
+// Fila de cada sensor muda a cada 5 s e difere por cruzamento
+static uint16_t sensor_hash(void *ctx, uint id, uint canal) {
+    Contadores *c = ctx;
+    c->leituras++;
+    uint32_t x = id * 2654435761u ^ (c->agora / 5000) * 40503u ^ canal * 0x9e3779b9u;
+    x ^= x >> 15;
+    x *= 0x2c1b3c6du;
+    x ^= x >> 12;
+    return x % 4096;
+}
+
+typedef struct {
+    Semaforo s;
+    uint32_t prazo;
+} Cruzamento;
+
+static uint32_t defasagem(uint i) {
+    return (i * 7919u) % (DEFASAGEM_MAX / 10) * 10;
+}
+
+static double segundos_desde(const struct timespec *t0) {
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return (t.tv_sec - t0->tv_sec) + (t.tv_nsec - t0->tv_nsec) / 1e9;
+}
+
+typedef struct {
+    double segundos;
+    uint64_t passos;
+    uint64_t varreduras;
+    Contadores saidas;
+} Medida;
+
+static Medida medir_objetos(uint n, uint32_t fim) {
+    Medida m = {0};
+    Cruzamento *c = malloc(n * sizeof(*c));
+    SaidasSemaforo saidas = {luz_conta, buzzer_conta, sensor_hash, &m.saidas};
+    for (uint i = 0; i < n; ++i) {
+        semaforo_init(&c[i].s, &saidas, i);
+        semaforo_selecionar_plano(&c[i].s, PLANO_ATUADO);
+        c[i].prazo = defasagem(i);
+    }
+
+    struct timespec t0;
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    uint32_t agora = 0;
+    while (agora < fim) {
+        m.saidas.agora = agora;
+        uint32_t proximo = UINT32_MAX;
+        for (uint i = 0; i < n; ++i) {
+            if (c[i].prazo <= agora) {
+                uint32_t espera = semaforo_passo(&c[i].s, agora);
+                c[i].prazo = agora + (espera ? espera : 1);
+                m.passos++;
+            }
+            if (c[i].prazo < proximo)
+                proximo = c[i].prazo;
+        }
+        m.varreduras++;
+        agora = proximo;
+    }
+    m.segundos = segundos_desde(&t0);
+    free(c);
+    return m;
+}
+
+static Medida medir_lote(uint n, uint32_t fim) {
+    Medida m = {0};
+    SemaforoEstado *estados = malloc(n * sizeof(*estados));
+    uint32_t *prazos = malloc(n * sizeof(*prazos));
+    SaidasSemaforo saidas = {luz_conta, buzzer_conta, sensor_hash, &m.saidas};
+    SemaforoLote lote;
+    semaforo_lote_init(&lote, estados, prazos, n, &saidas, PLANO_ATUADO, 0);
+    for (uint i = 0; i < n; ++i)
+        prazos[i] = defasagem(i);
+
+    struct timespec t0;
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    // Um passo sem ninguém vencido só devolve a espera até o primeiro prazo
+    uint32_t agora = 0;
+    while (agora < fim) {
+        m.saidas.agora = agora;
+        agora += semaforo_lote_passo(&lote, agora);
+        m.varreduras++;
+    }
+    m.segundos = segundos_desde(&t0);
+    m.passos = lote.passos;
+    free(estados);
+    free(prazos);
+    return m;
+}
+
+static void imprimir(const char *nome, uint n, const Medida *m) {
+    printf("  %-8s %10.3f s %12llu passos %10.2f Mpassos/s %8.2f ns/cruzamento por varredura\n", nome, m->segundos,
+           (unsigned long long)m->passos, m->passos / m->segundos / 1e6,
+           m->segundos * 1e9 / ((double)m->varreduras * n));
+}
+
+int main(int argc, char **argv) {
+    uint n_max = argc > 1 ? (uint)strtoul(argv[1], NULL, 10) : N_PADRAO;
+    int falhas = 0;
+
+    printf("%zu bytes por Semaforo, %zu por SemaforoEstado\n", sizeof(Semaforo), sizeof(SemaforoEstado));
+    for (uint n = 1; n <= n_max; n *= 10) {
+        double segundos = ORCAMENTO / n;
+        if (segundos > SEGUNDOS_MAX) segundos = SEGUNDOS_MAX;
+        if (segundos < SEGUNDOS_MIN) segundos = SEGUNDOS_MIN;
+        uint32_t fim = (uint32_t)(segundos * 1000);
+
+        Medida objetos = medir_objetos(n, fim);
+        Medida lote = medir_lote(n, fim);
+        printf("%u cruzamentos, %.0f s simulados\n", n, segundos);
+        imprimir("objetos", n, &objetos);
+        imprimir("lote", n, &lote);
+
+        if (objetos.passos != lote.passos || objetos.saidas.trocas_luz != lote.saidas.trocas_luz ||
+            objetos.saidas.trocas_buzzer != lote.saidas.trocas_buzzer ||
+            objetos.saidas.leituras != lote.saidas.leituras) {
+            printf("  FALHA: as arrumações divergem (luzes %llu/%llu, buzzer %llu/%llu)\n",
+                   (unsigned long long)objetos.saidas.trocas_luz, (unsigned long long)lote.saidas.trocas_luz,
+                   (unsigned long long)objetos.saidas.trocas_buzzer, (unsigned long long)lote.saidas.trocas_buzzer);
+            falhas++;
+        }
+    }
+    return falhas != 0;
+}
@@ -0,0 +1,163 @@
+// Compara as primitivas de desenho do display (retângulos, linhas, caracteres
+// e strings) com as versões anteriores, que escreviam pixel a pixel: mede o
+// tempo de cada uma e confere que as duas deixam o buffer igual. Roda no
+// computador, não no Pico:
+//
+//   gcc -O2 -DHAL_HOST -Ilib -Ihost tools/ssd1306_bench.c lib/ssd1306.c
+//       host/ssd1306_host.c -o ssd1306_bench
+//   ./ssd1306_bench
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "ssd1306.h"
+#include "font.h"
+
+#define SEGUNDOS_POR_CASO 0.2
+
+// Versões anteriores, como estavam antes da escrita por bytes inteiros
+static void antigo_pixel(ssd1306_t *ssd, uint8_t x, uint8_t y, bool value) {
+    uint16_t index = (y >> 3) + (x << 3) + 1;
+    uint8_t pixel = (y & 0b111);
+    if (value)
+        ssd->ram_buffer[index] |= (1 << pixel);
+    else
+        ssd->ram_buffer[index] &= ~(1 << pixel);
+}
+
+static void antigo_fill(ssd1306_t *ssd, bool value) {
+    for (uint8_t y = 0; y < ssd->height; ++y)
+        for (uint8_t x = 0; x < ssd->width; ++x)
+            antigo_pixel(ssd, x, y, value);
+}
+
+static void antigo_rect(ssd1306_t *ssd, uint8_t top, uint8_t left, uint8_t width, uint8_t height, bool value,
+                        bool fill) {
+    for (uint8_t x = left; x < left + width; ++x) {
+        antigo_pixel(ssd, x, top, value);
+        antigo_pixel(ssd, x, top + height - 1, value);
+    }
+    for (uint8_t y = top; y < top + height; ++y) {
+        antigo_pixel(ssd, left, y, value);
+        antigo_pixel(ssd, left + width - 1, y, value);
+    }
+    if (fill)
+        for (uint8_t x = left + 1; x < left + width - 1; ++x)
+            for (uint8_t y = top + 1; y < top + height - 1; ++y)
+                antigo_pixel(ssd, x, y, value);
+}
+
+static void antigo_hline(ssd1306_t *ssd, uint8_t x0, uint8_t x1, uint8_t y, bool value) {
+    for (uint8_t x = x0; x <= x1; ++x)
+        antigo_pixel(ssd, x, y, value);
+}
+
+static void antigo_vline(ssd1306_t *ssd, uint8_t x, uint8_t y0, uint8_t y1, bool value) {
+    for (uint8_t y = y0; y <= y1; ++y)
+        antigo_pixel(ssd, x, y, value);
+}
+
+static void antigo_draw_char(ssd1306_t *ssd, char c, uint8_t x, uint8_t y) {
+    uint16_t index = (c >= ' ' && c <= '~') ? (c - ' ') * 8 : 0;
+    for (uint8_t i = 0; i < 8; ++i) {
+        uint8_t line = font[index + i];
+        for (uint8_t j = 0; j < 8; ++j)
+            antigo_pixel(ssd, x + i, y + j, line & (1 << j));
+    }
+}
+
+static void antigo_draw_string(ssd1306_t *ssd, const char *str, uint8_t x, uint8_t y) {
+    while (*str) {
+        antigo_draw_char(ssd, *str++, x, y);
+        x += 8;
+        if (x + 8 >= ssd->width) {
+            x = 0;
+            y += 8;
+        }
+        if (y + 8 >= ssd->height)
+            break;
+    }
+}
+
+// Cada caso desenha a mesma coisa pelas duas versões; o valor alterna entre
+// as repetições para que nenhuma vire uma escrita sem efeito
+typedef struct {
+    const char *nome;
+    void (*antigo)(ssd1306_t *ssd, bool value);
+    void (*novo)(ssd1306_t *ssd, bool value);
+} Caso;
+
+static void fill_antigo(ssd1306_t *ssd, bool v) { antigo_fill(ssd, v); }
+static void fill_novo(ssd1306_t *ssd, bool v) { ssd1306_fill(ssd, v); }
+static void rect_cheio_antigo(ssd1306_t *ssd, bool v) { antigo_rect(ssd, 10, 5, 100, 40, v, true); }
+static void rect_cheio_novo(ssd1306_t *ssd, bool v) { ssd1306_rect(ssd, 10, 5, 100, 40, v, true); }
+static void rect_contorno_antigo(ssd1306_t *ssd, bool v) { antigo_rect(ssd, 3, 2, 120, 58, v, false); }
+static void rect_contorno_novo(ssd1306_t *ssd, bool v) { ssd1306_rect(ssd, 3, 2, 120, 58, v, false); }
+static void hline_antigo(ssd1306_t *ssd, bool v) { antigo_hline(ssd, 0, 127, 37, v); }
+static void hline_novo(ssd1306_t *ssd, bool v) { ssd1306_hline(ssd, 0, 127, 37, v); }
+static void vline_antigo(ssd1306_t *ssd, bool v) { antigo_vline(ssd, 64, 0, 63, v); }
+static void vline_novo(ssd1306_t *ssd, bool v) { ssd1306_vline(ssd, 64, 0, 63, v); }
+
+// Textos do firmware: uma linha alinhada à página e uma deslocada, que divide
+// cada coluna do glifo entre duas páginas
+static const char *texto(bool v) { return v ? "IntelliTraffic" : "NORMAL VERMELHO"; }
+static void texto_antigo(ssd1306_t *ssd, bool v) { antigo_draw_string(ssd, texto(v), 0, 16); }
+static void texto_novo(ssd1306_t *ssd, bool v) { ssd1306_draw_string(ssd, texto(v), 0, 16); }
+static void texto_deslocado_antigo(ssd1306_t *ssd, bool v) { antigo_draw_string(ssd, texto(v), 0, 21); }
+static void texto_deslocado_novo(ssd1306_t *ssd, bool v) { ssd1306_draw_string(ssd, texto(v), 0, 21); }
+static void caractere_antigo(ssd1306_t *ssd, bool v) { antigo_draw_char(ssd, v ? 'A' : 'V', 40, 8); }
+static void caractere_novo(ssd1306_t *ssd, bool v) { ssd1306_draw_char(ssd, v ? 'A' : 'V', 40, 8); }
+
+static const Caso casos[] = {
+    {"fill", fill_antigo, fill_novo},
+    {"rect cheio 100x40", rect_cheio_antigo, rect_cheio_novo},
+    {"rect contorno 120x58", rect_contorno_antigo, rect_contorno_novo},
+    {"hline 128", hline_antigo, hline_novo},
+    {"vline 64", vline_antigo, vline_novo},
+    {"caractere", caractere_antigo, caractere_novo},
+    {"string em y = 16", texto_antigo, texto_novo},
+    {"string em y = 21", texto_deslocado_antigo, texto_deslocado_novo},
+};
+
+static double agora_s(void) {
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec + t.tv_nsec / 1e9;
+}
+
+// ns por chamada, repetindo até SEGUNDOS_POR_CASO
+static double medir(ssd1306_t *ssd, void (*desenhar)(ssd1306_t *, bool)) {
+    uint64_t chamadas = 0;
+    double inicio = agora_s(), decorrido;
+    do {
+        for (int i = 0; i < 1000; ++i)
+            desenhar(ssd, i & 1);
+        chamadas += 1000;
+        decorrido = agora_s() - inicio;
+    } while (decorrido < SEGUNDOS_POR_CASO);
+    return decorrido * 1e9 / chamadas;
+}
+
+int main(void) {
+    ssd1306_t antigo, novo;
+    ssd1306_init(&antigo, WIDTH, HEIGHT, false, 0x3C, NULL);
+    ssd1306_init(&novo, WIDTH, HEIGHT, false, 0x3C, NULL);
+    int falhas = 0;
+
+    printf("%-24s %12s %12s %9s\n", "caso", "antes (ns)", "agora (ns)", "ganho");
+    for (size_t i = 0; i < sizeof(casos) / sizeof(casos[0]); ++i) {
+        const Caso *c = &casos[i];
+        // Mesmo desenho sobre o mesmo fundo nas duas versões
+        memset(antigo.ram_buffer + 1, 0x5A, antigo.bufsize - 1);
+        memset(novo.ram_buffer + 1, 0x5A, novo.bufsize - 1);
+        c->antigo(&antigo, true);
+        c->novo(&novo, true);
+        bool igual = memcmp(antigo.ram_buffer, novo.ram_buffer, novo.bufsize) == 0;
+
+        double t_antigo = medir(&antigo, c->antigo);
+        double t_novo = medir(&novo, c->novo);
+        printf("%-24s %12.1f %12.1f %8.1fx%s\n", c->nome, t_antigo, t_novo, t_antigo / t_novo,
+               igual ? "" : "  FALHA: buffers diferentes");
+        falhas += !igual;
+    }
+    return falhas != 0;
+}